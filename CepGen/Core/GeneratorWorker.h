@@ -24,6 +24,7 @@
 #include "CepGen/Event/Event.h"
 
 namespace cepgen {
+  class AsynchronousExporters;
   class Integrator;
   class RunParameters;
   class ProcessIntegrand;
@@ -43,15 +44,21 @@ namespace cepgen {
 
     void setRunParameters(const RunParameters*);  ///< Specify the runtime parameters
     void setIntegrator(const Integrator*);        ///< Specify the integrator instance handled by the mother generator
+    /// Specify an asynchronous export stage to feed instead of the output modules (nullptr for a synchronous output)
+    inline void setAsynchronousExporters(AsynchronousExporters* exporters) { async_exporters_ = exporters; }
 
     /// Launch the event generation
     /// \param[in] num_events Events multiplicity to generate
     /// \param[in] callback The callback function applied on every event generated
+    /// \note This method may be called concurrently from several threads, each of them handling its own worker. In
+    ///  this case, the run-wide events multiplicity is shared among all workers.
     void generate(size_t num_events, const std::function<void(const proc::Process&)>& callback);
 
     inline ProcessIntegrand& integrand() const { return *integrand_; }  ///< Function evaluator
 
     virtual void initialise() = 0;  ///< Initialise the generation parameters
+    /// Initialise the generation parameters from an already initialised worker (e.g. for multi-threaded generation)
+    virtual void initialiseFrom(const GeneratorWorker&) { initialise(); }
     virtual bool next() = 0;        ///< Generate a single event
 
   protected:
@@ -60,11 +67,13 @@ namespace cepgen {
     bool storeEvent() const;
 
     // NOT owned
-    const Integrator* integrator_{nullptr};     ///< Pointer to the mother-handled integrator instance
-    const RunParameters* run_params_{nullptr};  ///< Steering parameters for the event generation
+    const Integrator* integrator_{nullptr};            ///< Pointer to the mother-handled integrator instance
+    const RunParameters* run_params_{nullptr};         ///< Steering parameters for the event generation
+    AsynchronousExporters* async_exporters_{nullptr};  ///< Asynchronous export stage, if any
 
     std::unique_ptr<ProcessIntegrand> integrand_;                       ///< Local event weight evaluator
     std::function<void(const proc::Process&)> callback_proc_{nullptr};  ///< Callback function for each new event
+    size_t max_events_{0};                                              ///< Run-wide events to generate (0=unbounded)
   };
 }  // namespace cepgen
 
@@ -19,6 +19,9 @@
 #ifndef CepGen_Event_Event_h
 #define CepGen_Event_Event_h
 
+#include <bitset>
+#include <unordered_map>
+
 #include "CepGen/Event/Particle.h"
 
 namespace cepgen {
@@ -125,10 +128,47 @@ namespace cepgen {
     ParticleRoles roles() const;
 
     /// Collection of key -> value pairs storing event metadata
-    struct EventMetadata : std::unordered_map<std::string, float> {
+    /// \note Keys are interned once into integer slots of a process-wide registry, and their values are stored in a
+    ///  fixed-size array on the event, thus avoiding any string hashing or heap allocation on the events loop
+    class EventMetadata {
+    public:
       EventMetadata();
+
+      static constexpr size_t MAX_KEYS = 32;  ///< Maximal number of distinct metadata keys
+      /// Predefined metadata slots
+      enum Key : size_t { TIME_GENERATION = 0, TIME_TOTAL, WEIGHT, ALPHA_EM, ALPHA_S };
+      /// Retrieve (or register if not yet known) the integer slot associated with a metadata key
+      static size_t key(const std::string&);
+      static std::string name(size_t key);  ///< Retrieve the name of a registered metadata key
+
+      bool operator==(const EventMetadata&) const;  ///< Equality operator
+      inline bool operator!=(const EventMetadata& oth) const { return !operator==(oth); }  ///< Inequality operator
+
+      /// Retrieve the metadata value associated with a key slot
+      inline float operator()(size_t key) const { return key < MAX_KEYS && set_[key] ? values_[key] : -1.; }
       /// Retrieve the metadata value associated with a key
-      float operator()(const std::string& key) const { return count(key) > 0 ? at(key) : -1.; }
+      float operator()(const std::string& key) const;
+      /// Reference to the metadata value associated with a key slot
+      inline float& operator[](size_t key) {
+        if (key >= MAX_KEYS)
+          invalidKey(key);
+        if (!set_[key]) {
+          set_[key] = true;
+          values_[key] = 0.;
+        }
+        return values_[key];
+      }
+      /// Reference to the metadata value associated with a key
+      inline float& operator[](const std::string& key) { return operator[](EventMetadata::key(key)); }
+      inline bool has(size_t key) const { return key < MAX_KEYS && set_[key]; }  ///< Is a key slot populated?
+
+      void clear();                                            ///< Remove all metadata values
+      std::unordered_map<std::string, float> entries() const;  ///< All populated key -> value pairs
+
+    private:
+      [[noreturn]] static void invalidKey(size_t);
+      std::array<float, MAX_KEYS> values_;
+      std::bitset<MAX_KEYS> set_;
     };
     /// List of auxiliary information
     EventMetadata metadata;
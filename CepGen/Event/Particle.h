@@ -19,6 +19,8 @@
 #ifndef CepGen_Event_Particle_h
 #define CepGen_Event_Particle_h
 
+#include <array>
+#include <iterator>
 #include <set>
 
 #include "CepGen/Physics/Momentum.h"
@@ -165,13 +167,104 @@ namespace cepgen {
   using ParticlesRefs = std::vector<ParticleRef>;        ///< List of references to Particle objects
   using ParticleRoles = std::vector<Particle::Role>;     ///< List of particles' roles
 
-  /// Map between a particle's role and its associated Particle object
-  class ParticlesMap : public std::unordered_map<Particle::Role, Particles, utils::EnumHash<Particle::Role> > {
+  /// Map between a particle's role and its associated Particle objects
+  /// \note Particles are stored in one fixed slot per role, thus avoiding any hashing or node allocation on role lookup
+  class ParticlesMap {
   public:
-    ParticlesMap() = default;
-    ParticlesMap(const ParticlesMap&);             ///< Copy constructor
-    ParticlesMap& operator=(const ParticlesMap&);  ///< Assignment operator
-    ~ParticlesMap() = default;
+    using value_type = std::pair<Particle::Role, Particles>;  ///< Role and its associated particles
+    static constexpr size_t NUM_ROLES = 9;                    ///< Number of roles (undefined one included)
+
+    ParticlesMap();
+
+    bool operator==(const ParticlesMap&) const;  ///< Equality operator
+    inline bool operator!=(const ParticlesMap& oth) const { return !operator==(oth); }  ///< Inequality operator
+
+    /// List of particles associated with a role (registered if not yet present in the map)
+    inline Particles& operator[](Particle::Role role) {
+      const auto slot_id = slot(role);
+      registered_[slot_id] = true;
+      return slots_[slot_id].second;
+    }
+    /// List of particles associated with a role
+    inline const Particles& at(Particle::Role role) const {
+      const auto slot_id = slot(role);
+      if (!registered_[slot_id])
+        missingRole(role);
+      return slots_[slot_id].second;
+    }
+    /// Is a role registered in this map? (0 or 1)
+    inline size_t count(Particle::Role role) const { return registered_[slot(role)] ? 1 : 0; }
+    bool empty() const;  ///< Is there any role registered in this map?
+    void clear();        ///< Unregister all roles, and remove all their particles
+
+    /// Forward iterator over all registered (role, particles) pairs
+    template <typename M, typename V>
+    class Iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = ParticlesMap::value_type;
+      using difference_type = std::ptrdiff_t;
+      using pointer = V*;
+      using reference = V&;
+
+      Iterator(M& map, size_t slot_id) : map_(&map), slot_id_(slot_id) { skip(); }
+      inline reference operator*() const { return map_->slots_[slot_id_]; }
+      inline pointer operator->() const { return &map_->slots_[slot_id_]; }
+      inline Iterator& operator++() {
+        ++slot_id_;
+        skip();
+        return *this;
+      }
+      inline bool operator==(const Iterator& oth) const { return slot_id_ == oth.slot_id_; }
+      inline bool operator!=(const Iterator& oth) const { return slot_id_ != oth.slot_id_; }
+
+    private:
+      inline void skip() {
+        while (slot_id_ < NUM_ROLES && !map_->registered_[slot_id_])
+          ++slot_id_;
+      }
+      M* map_;
+      size_t slot_id_;
+    };
+    using iterator = Iterator<ParticlesMap, value_type>;
+    using const_iterator = Iterator<const ParticlesMap, const value_type>;
+
+    inline iterator begin() { return iterator(*this, 0); }
+    inline iterator end() { return iterator(*this, NUM_ROLES); }
+    inline const_iterator begin() const { return const_iterator(*this, 0); }
+    inline const_iterator end() const { return const_iterator(*this, NUM_ROLES); }
+
+  private:
+    /// Fixed storage slot associated with a role
+    static inline size_t slot(Particle::Role role) {
+      switch (role) {
+        case Particle::Role::IncomingBeam1:
+          return 0;
+        case Particle::Role::IncomingBeam2:
+          return 1;
+        case Particle::Role::Parton1:
+          return 2;
+        case Particle::Role::Parton2:
+          return 3;
+        case Particle::Role::Intermediate:
+          return 4;
+        case Particle::Role::OutgoingBeam1:
+          return 5;
+        case Particle::Role::OutgoingBeam2:
+          return 6;
+        case Particle::Role::CentralSystem:
+          return 7;
+        case Particle::Role::UnknownRole:  // e.g. particles produced by external hadronisers; iterated last
+          return 8;
+        default:
+          invalidRole(role);
+      }
+    }
+    [[noreturn]] static void invalidRole(Particle::Role);
+    [[noreturn]] static void missingRole(Particle::Role);
+
+    std::array<value_type, NUM_ROLES> slots_;  ///< Particles associated with each role
+    std::array<bool, NUM_ROLES> registered_;   ///< Is the role registered in the map?
   };
 }  // namespace cepgen
 
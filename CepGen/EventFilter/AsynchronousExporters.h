@@ -0,0 +1,55 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_EventFilter_AsynchronousExporters_h
+#define CepGen_EventFilter_AsynchronousExporters_h
+
+#include <memory>
+#include <vector>
+
+namespace cepgen {
+  class Event;
+  class EventExporter;
+  /// Asynchronous export stage, decoupling the events writing from their generation
+  /// \note Each accepted event is copied once and queued into a bounded lock-free buffer for each output module. One
+  ///  background thread per output module writes the queued events in the order they were accepted, thus preserving
+  ///  the output module's own events numbering. Whenever a buffer is full, the generation is paused until the
+  ///  corresponding writer thread frees a slot.
+  class AsynchronousExporters {
+  public:
+    /// Start the writer threads for a collection of output modules
+    /// \param[in] exporters Output modules to feed
+    /// \param[in] buffer_size Maximal number of events queued for each output module
+    AsynchronousExporters(const std::vector<std::unique_ptr<EventExporter> >& exporters, size_t buffer_size);
+    ~AsynchronousExporters();  ///< Write all queued events and stop the writer threads
+
+    /// Queue an event for all output modules
+    /// \return False if an output module failed to write a previous event
+    /// \note Any exception raised by an output module on a previous event is propagated to the calling thread
+    bool operator<<(const Event&);
+    /// Wait until all queued events are written
+    /// \note Any exception raised by an output module is propagated to the calling thread
+    void flush();
+
+  private:
+    struct Writer;
+    std::vector<std::unique_ptr<Writer> > writers_;
+  };
+}  // namespace cepgen
+
+#endif
@@ -19,6 +19,7 @@
 #ifndef CepGen_EventFilter_EventBrowser_h
 #define CepGen_EventFilter_EventBrowser_h
 
+#include <array>
 #include <regex>
 
 #include "CepGen/Event/Particle.h"
@@ -31,17 +32,64 @@ namespace cepgen::utils {
   /// \author Laurent Forthomme <laurent.forthomme@cern.ch>
   /// \date Jul 2019
   class EventBrowser {
+  private:
+    typedef double (Momentum::*pMethod)() const;
+    typedef double (Momentum::*pMethodOth)(const Momentum&) const;
+
   public:
     EventBrowser() = default;
-    double get(const Event& event, const std::string& variable_name) const;  ///< Get/compute a variable value
+
+    /// Variable accessor, parsed once from its expression, and evaluated on events without any string manipulation
+    class Accessor {
+    public:
+      Accessor() = default;
+      double operator()(const Event&) const;                    ///< Compute the variable value for an event
+      inline const std::string& name() const { return name_; }  ///< Variable expression
+
+    private:
+      friend class EventBrowser;
+      enum struct Quantity {
+        invalid,
+        momentum,
+        twoMomenta,
+        acoplanarity,
+        xi,
+        pdg,
+        charge,
+        status,
+        numParticles,
+        numOutgoingBeam1,
+        numOutgoingBeam2,
+        missingEt,
+        missingEtPhi,
+        cmEnergy,
+        metadata
+      };
+      /// Particle selection, from its role or its identifier in the event
+      struct Selector {
+        const Particle& operator()(const Event&) const;
+        bool by_role{false};
+        Particle::Role role{Particle::Role::UnknownRole};
+        int id{0};
+      };
+      std::string name_;
+      Quantity quantity_{Quantity::invalid};
+      size_t num_particles_{0};                 ///< Number of particles involved (0 for event-level variables)
+      std::array<Selector, 2> selectors_{};     ///< Particles selectors
+      pMethod momentum_method_{nullptr};        ///< Single-momentum getter method
+      pMethodOth two_momenta_method_{nullptr};  ///< Two-momenta getter method
+      size_t metadata_key_{0};                  ///< Metadata key slot
+    };
+
+    Accessor compile(const std::string& variable_name) const;  ///< Parse a variable expression into an accessor
+    /// Get/compute a variable value
+    /// \note The expression is parsed at each call; compile() should be preferred for repeated evaluations
+    double get(const Event& event, const std::string& variable_name) const;
 
   private:
-    double variable(const Event&, const Particle&, const std::string&) const;  ///< Retrieve a particle variable
-    double variable(const Event&,
-                    const Particle&,
-                    const Particle&,
-                    const std::string&) const;                 ///< Retrieve a two-particle variable
-    static double variable(const Event&, const std::string&);  ///< Retrieve a whole event variable
+    /// Parse a particle-level variable
+    void compileParticleVariable(Accessor&, const std::string&) const;
+    static void compileEventVariable(Accessor&, const std::string&);  ///< Parse a whole event variable
 
     static const std::regex rgx_select_id_;
     static const std::regex rgx_select_id2_;
@@ -58,7 +106,6 @@ namespace cepgen::utils {
                                                                        {"pa2", Particle::Role::Parton2},
                                                                        {"cs", Particle::Role::CentralSystem},
                                                                        {"int", Particle::Role::Intermediate}};
-    typedef double (Momentum::*pMethod)() const;
     /// Mapping of string variables to momentum getter methods
     const std::unordered_map<std::string, pMethod> m_mom_str_ = {
         {"px", &Momentum::px},        {"py", &Momentum::py},      {"pz", &Momentum::pz},
@@ -69,7 +116,6 @@ namespace cepgen::utils {
         {"p", &Momentum::p},          {"p2", &Momentum::p2},      {"th", &Momentum::theta},
         {"y", &Momentum::rapidity},   {"beta", &Momentum::beta},  {"gamma", &Momentum::gamma},
         {"gamma2", &Momentum::gamma2}};
-    typedef double (Momentum::*pMethodOth)(const Momentum&) const;
     const std::unordered_map<std::string, pMethodOth> m_two_mom_str_ = {{"deta", &Momentum::deltaEta},
                                                                         {"dphi", &Momentum::deltaPhi},
                                                                         {"dpt", &Momentum::deltaPt},
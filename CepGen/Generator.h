@@ -19,11 +19,13 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "CepGen/Utils/Value.h"
 
 /// Common namespace for this Monte Carlo generator
 namespace cepgen {
+  class AsynchronousExporters;
   class Event;
   class Integrator;
   class GeneratorWorker;
@@ -41,6 +43,12 @@ namespace cepgen {
   bool callPath(const std::string&, const std::function<bool(const std::string&)>&);
   bool loadLibrary(const std::string&, bool match = false);    ///< Import a shared library in RTE
   bool unloadLibrary(const std::string&, bool match = false);  ///< Unload a shared library from RTE
+  /// Import the add-on(s) providing a named module, as declared in the modules manifest
+  /// \param[in] name Module name/index
+  /// \param[in] macros Registration macros of the requesting factory (any macro if empty)
+  /// \return True if at least one additional library was loaded into the RTE
+  bool loadModule(const std::string& name, const std::vector<std::string>& macros = {});
+  void loadAllModules();  ///< Import all add-ons declared in the modules manifest and not yet loaded
   /// Launch the initialisation procedure
   /// \param[in] safe_mode Drop libraries initialisation?
   void initialise(bool safe_mode = false);
@@ -89,12 +97,21 @@ namespace cepgen {
     void initialise();       ///< Initialise event generation
     void clearRun();         ///< Remove all references to a previous generation/run
     void resetIntegrator();  ///< Reset integrator algorithm from the user-specified configuration
+    /// Build an additional generator worker for multi-threaded event generation
+    /// \param[in] thread_id Index of the thread, used to decorrelate the random number streams
+    std::unique_ptr<GeneratorWorker> buildWorker(size_t thread_id) const;
+    /// Set (or remove if null) the asynchronous export stage fed by all generator workers
+    void setAsynchronousExporters(std::unique_ptr<AsynchronousExporters>);
 
     std::unique_ptr<RunParameters> parameters_;  ///< Run parameters for event generation and cross-section computation
+    /// Background writers feeding the output modules, if any (destructed before the run parameters)
+    std::unique_ptr<AsynchronousExporters> async_exporters_;
     std::unique_ptr<GeneratorWorker> worker_;    ///< Generator worker instance
     std::unique_ptr<Integrator> integrator_;     ///< Integration algorithm
     bool initialised_{false};                    ///< Has the event generator already been initialised?
     Value cross_section_{-1., -1.};              ///< Cross-section value computed at the last integration
+    /// Additional generator workers, each of them running in its own thread for multi-threaded event generation
+    std::vector<std::unique_ptr<GeneratorWorker> > workers_;
   };
 }  // namespace cepgen
 
@@ -27,14 +27,20 @@ namespace cepgen {
   /// Wrapper to the function to be integrated
   class FunctionIntegrand final : public Integrand {
   public:
-    explicit FunctionIntegrand(size_t, const std::function<double(const std::vector<double>&)>&);
+    /// Build an integrand from a function
+    /// \param[in] reentrant May the function be evaluated concurrently (i.e. has no shared mutable state)?
+    explicit FunctionIntegrand(size_t,
+                               const std::function<double(const std::vector<double>&)>&,
+                               bool reentrant = false);
 
     double eval(const std::vector<double>&) override;
     size_t size() const override { return num_dimensions_; }
+    std::unique_ptr<Integrand> clone(size_t seed_offset) const override;
 
   private:
     const std::function<double(const std::vector<double>&)> function_{};
     const size_t num_dimensions_{0ull};
+    const bool reentrant_{false};  ///< may the function be evaluated concurrently by integrand clones?
   };
 }  // namespace cepgen
 
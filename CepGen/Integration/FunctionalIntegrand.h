@@ -34,8 +34,11 @@ namespace cepgen {
 
     double eval(const std::vector<double>&) override;
     size_t size() const override;
+    std::unique_ptr<Integrand> clone(size_t seed_offset) const override;
 
   private:
+    explicit FunctionalIntegrand(std::unique_ptr<utils::Functional>);
+
     std::unique_ptr<utils::Functional> functional_;
   };
 }  // namespace cepgen
@@ -0,0 +1,73 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Integration_GridCache_h
+#define CepGen_Integration_GridCache_h
+
+#include <string>
+
+namespace cepgen {
+  class GridParameters;
+  class Integrator;
+  class ParametersList;
+  class RunParameters;
+  class Value;
+  /// Persistent storage of the integration and generation grids computed for a given run configuration
+  /// \note Cache entries are keyed by a hash of the process, kinematics, event treatment and integration/generation
+  ///  parameters (random number generators seeds excluded). Jobs with identical configurations can thus reuse the
+  ///  grids and cross-section computed by a previous run, and skip directly to the event generation. The full
+  ///  configuration is stored in each entry, and checked against the current one upon retrieval.
+  class GridCache {
+  public:
+    /// Build a cache handler for a given run configuration
+    /// \note Cache directory is retrieved from the generation parameters
+    explicit GridCache(const RunParameters&);
+
+    static bool enabled(const RunParameters&);  ///< Is the grids caching enabled for this run?
+
+    /// Retrieve a cross-section and restore the integrator grid it was computed with
+    /// \return A boolean stating whether a compatible cache entry was found
+    bool loadIntegration(Integrator&, Value& cross_section) const;
+    /// Store a cross-section and the integrator grid it was computed with
+    void saveIntegration(const Integrator&, const Value& cross_section) const;
+    /// Retrieve the per-bin function maxima of an unweighting grid
+    /// \param[in] integrator Integrator whose grid is used for the phase space treatment
+    /// \param[in] worker_parameters Parameters of the generator worker building this grid
+    /// \param[out] grid Unweighting grid to populate
+    /// \return A boolean stating whether a compatible cache entry was found
+    bool loadGeneration(const Integrator& integrator,
+                        const ParametersList& worker_parameters,
+                        GridParameters& grid) const;
+    /// Store the per-bin function maxima of a prepared unweighting grid
+    void saveGeneration(const Integrator&, const ParametersList& worker_parameters, const GridParameters&) const;
+
+    inline size_t key() const { return key_; }  ///< Configuration hash for this run
+
+  private:
+    /// Summary of all the parameters affecting an unweighting grid
+    std::string generationConfiguration(const Integrator&, const ParametersList&) const;
+    std::string path(size_t key, const std::string& type) const;
+
+    const std::string directory_;
+    const size_t num_points_;
+    const std::string configuration_;  ///< Full run configuration, stored alongside the cached grids
+    const size_t key_;
+  };
+}  // namespace cepgen
+
+#endif
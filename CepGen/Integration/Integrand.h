@@ -19,6 +19,7 @@
 #ifndef CepGen_Integration_Integrand_h
 #define CepGen_Integration_Integrand_h
 
+#include <memory>
 #include <vector>
 
 namespace cepgen {
@@ -29,8 +30,18 @@ namespace cepgen {
     virtual ~Integrand() = default;
 
     virtual double eval(const std::vector<double>&) = 0;  ///< Compute the integrand for a given coordinates set
+    /// Compute the integrand for a batch of coordinates sets
+    /// \param[in] num_points Number of phase space points in the batch
+    /// \param[in] coordinates Contiguous (point-major) block of num_points \f$\times\f$ size() coordinates
+    /// \param[out] weights Integrand values for all points of the batch
+    virtual void evalBatch(size_t num_points, const double* coordinates, double* weights);
     virtual size_t size() const = 0;                      ///< Phase space dimension
     virtual bool hasProcess() const { return false; }     ///< Does this integrand also contain a process object?
+
+    /// Build an independent copy of this integrand, to be evaluated concurrently with the original one
+    /// \param[in] seed_offset Offset applied to the seeds of all random number generators owned by the copy
+    /// \return A null pointer if the integrand cannot be cloned (in which case it may only be evaluated serially)
+    virtual std::unique_ptr<Integrand> clone(size_t /*seed_offset*/) const { return nullptr; }
   };
 }  // namespace cepgen
 
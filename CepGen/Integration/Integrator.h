@@ -40,6 +40,13 @@ namespace cepgen {
     virtual bool oneDimensional() const { return false; }  ///< Is the integrator designed for one-dimensional case?
     virtual double eval(Integrand&, const std::vector<double>&) const;  ///< Compute function value at one point
 
+    /// Serialised state of the integration grid (empty if not supported by the algorithm)
+    /// \note This state can be persisted and later fed to restoreGridState to skip a new integration
+    virtual std::vector<double> gridState() const { return {}; }
+    /// Restore a previously computed integration grid state
+    /// \return A boolean stating whether the state was compatible with this integrator and could be restored
+    virtual bool restoreGridState(const std::vector<double>&) { return false; }
+
     /// Evaluate the integral for a given range
     Value integrate(Integrand& integrand, const std::vector<Limits>& = {});
     /// Evaluate the integral of a function for a given range
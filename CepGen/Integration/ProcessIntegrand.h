@@ -23,14 +23,17 @@
 
 #include "CepGen/EventFilter/EventBrowser.h"
 #include "CepGen/Integration/Integrand.h"
+#include "CepGen/Physics/CompiledCuts.h"
 
 namespace cepgen {
+  class EventModifier;
   class RunParameters;
 }
 namespace cepgen::proc {
   class Process;
 }
 namespace cepgen::utils {
+  class Functional;
   class Timer;
 }
 
@@ -40,6 +43,7 @@ namespace cepgen {
   public:
     explicit ProcessIntegrand(const proc::Process&);
     explicit ProcessIntegrand(const RunParameters*);
+    ~ProcessIntegrand() override;
 
     /// Compute the integrand for a given phase space point (or “event”)
     /// \param[in] x Phase space point coordinates
@@ -48,8 +52,10 @@ namespace cepgen {
     ///  \f${\bf x}=\{x_1,\ldots,x_N\}\f$ is therefore an array of random numbers defined inside its boundaries
     ///  (as normalised so that \f$\forall i=1,\ldots,N\f$, \f$0<x_i<1\f$).
     double eval(const std::vector<double>& x) override;
+    void evalBatch(size_t num_points, const double* coordinates, double* weights) override;
     size_t size() const override;  ///< Phase space dimension
     bool hasProcess() const override { return true; }
+    std::unique_ptr<Integrand> clone(size_t seed_offset) const override;
 
     proc::Process& process();              ///< Thread-local physics process
     const proc::Process& process() const;  ///< Thread-local physics process
@@ -57,14 +63,32 @@ namespace cepgen {
     void setStorage(bool store) { storage_ = store; }  ///< Specify if the generated events will be stored
     bool storage() const { return storage_; }          ///< Store the events generated in this run?
 
+    /// Use a local collection of event modification algorithms instead of the one owned by the run parameters
+    /// \note Required whenever several integrands are evaluated concurrently, e.g. in multi-threaded generation
+    void setEventModifiersSequence(std::vector<std::unique_ptr<EventModifier> >&&);
+    /// Build an independent copy of the event modification algorithms sequence used by this integrand
+    /// \param[in] seed_offset Offset applied to the random number generators seeds of all algorithms
+    std::vector<std::unique_ptr<EventModifier> > cloneEventModifiers(size_t seed_offset) const;
+
   private:
+    explicit ProcessIntegrand(const proc::Process&, const RunParameters*);
+
     void setProcess(const proc::Process&);
+    double computeWeight(const std::vector<double>&);  ///< Compute the weight of a single phase space point
+
+    const std::vector<std::unique_ptr<EventModifier> >& eventModifiers() const;  ///< Event modification algorithms
 
-    std::unique_ptr<proc::Process> process_;        ///< Local instance of the physics process
-    const RunParameters* run_parameters_{nullptr};  ///< Generator-owned runtime parameters
-    const std::unique_ptr<utils::Timer> timer_;     ///< Timekeeper for event generation
-    utils::EventBrowser bws_;                       ///< Event browser
-    bool storage_{false};                           ///< Will the next event generated be stored?
+    std::unique_ptr<proc::Process> process_;                        ///< Local instance of the physics process
+    const RunParameters* run_parameters_{nullptr};                  ///< Generator-owned runtime parameters
+    const std::unique_ptr<utils::Timer> timer_;                     ///< Timekeeper for event generation
+    utils::EventBrowser bws_;                                       ///< Event browser
+    std::vector<std::unique_ptr<utils::Functional> > taming_functions_;  ///< Integrand-owned taming functions
+    std::vector<utils::EventBrowser::Accessor> taming_variables_;        ///< Compiled taming functions variables
+    bool storage_{false};                                           ///< Will the next event generated be stored?
+    std::vector<double> coordinates_;                               ///< Coordinates buffer for batch evaluations
+    std::unique_ptr<cuts::Compiled> cuts_;                          ///< Active phase space cuts
+    cuts::KinematicRecord kinematic_record_;                        ///< Minimal kinematic content for cuts evaluation
+    std::vector<std::unique_ptr<EventModifier> > local_modifiers_;  ///< Integrand-owned event modification algorithms
   };
 }  // namespace cepgen
 
@@ -38,7 +38,7 @@ namespace cepgen::card {
 namespace cepgen {
   class RunParameters;
   /// A card handler base factory
-  DEFINE_FACTORY(BaseCardsHandlerFactory, card::Handler, "Cards handlers factory");
+  DEFINE_FACTORY(BaseCardsHandlerFactory, card::Handler, "Cards handlers factory", "CARD_HANDLER");
   /// A card handler factory
   struct CardsHandlerFactory final : BaseCardsHandlerFactory {
     using BaseCardsHandlerFactory::BaseCardsHandlerFactory;
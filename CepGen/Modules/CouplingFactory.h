@@ -44,9 +44,9 @@
 namespace cepgen {
   class Coupling;
   /// An electromagnetic coupling evolution algorithms factory
-  DEFINE_FACTORY(AlphaEMFactory, Coupling, "Electromagnetic coupling evolution factory");
+  DEFINE_FACTORY(AlphaEMFactory, Coupling, "Electromagnetic coupling evolution factory", "ALPHAEM_MODULE");
   /// A strong coupling evolution algorithms factory
-  DEFINE_FACTORY(AlphaSFactory, Coupling, "Strong coupling evolution factory");
+  DEFINE_FACTORY(AlphaSFactory, Coupling, "Strong coupling evolution factory", "ALPHAS_MODULE");
 }  // namespace cepgen
 
 #endif
@@ -37,7 +37,7 @@ namespace cepgen::utils {
 
 namespace cepgen {
   /// An analytical derivator objects factory
-  DEFINE_FACTORY(DerivatorFactory, utils::Derivator, "Derivators factory");
+  DEFINE_FACTORY(DerivatorFactory, utils::Derivator, "Derivators factory", "DERIVATOR");
 }  // namespace cepgen
 
 #endif
@@ -36,7 +36,10 @@ namespace cepgen {
     class DocumentationGenerator;
   }
   /// A documentation generator factory
-  DEFINE_FACTORY(DocumentationGeneratorFactory, utils::DocumentationGenerator, "Documentation generator factory");
+  DEFINE_FACTORY(DocumentationGeneratorFactory,
+                 utils::DocumentationGenerator,
+                 "Documentation generator factory",
+                 "DOCUMENTATION_GENERATOR");
 }  // namespace cepgen
 
 #endif
@@ -37,7 +37,7 @@ namespace cepgen::utils {
 
 namespace cepgen {
   /// A plotting utilities factory
-  DEFINE_FACTORY(DrawerFactory, utils::Drawer, "Drawing utility factory");
+  DEFINE_FACTORY(DrawerFactory, utils::Drawer, "Drawing utility factory", "DRAWER");
 }  // namespace cepgen
 
 #endif
@@ -34,7 +34,7 @@
 namespace cepgen {
   class EventModifier;
   /// An event modifier algorithms factory
-  DEFINE_FACTORY(EventModifierFactory, EventModifier, "Event modifiers factory");
+  DEFINE_FACTORY(EventModifierFactory, EventModifier, "Event modifiers factory", "MODIFIER");
 }  // namespace cepgen
 
 #endif
@@ -39,7 +39,7 @@ namespace cepgen::formfac {
 
 namespace cepgen {
   /// A form factors parameterisations factory
-  DEFINE_FACTORY(FormFactorsFactory, formfac::Parameterisation, "Nucleon form factors factory");
+  DEFINE_FACTORY(FormFactorsFactory, formfac::Parameterisation, "Nucleon form factors factory", "FORMFACTORS");
 }  // namespace cepgen
 
 #endif
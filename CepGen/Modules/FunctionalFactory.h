@@ -37,7 +37,7 @@ namespace cepgen::utils {
 
 namespace cepgen {
   /// A functional objects factory
-  DEFINE_FACTORY(FunctionalFactory, utils::Functional, "Functional factory");
+  DEFINE_FACTORY(FunctionalFactory, utils::Functional, "Functional factory", "FUNCTIONAL");
 }  // namespace cepgen
 
 #endif
@@ -34,7 +34,7 @@
 namespace cepgen {
   class GeneratorWorker;
   /// A generator worker algorithms factory
-  DEFINE_FACTORY(GeneratorWorkerFactory, GeneratorWorker, "Generator worker factory");
+  DEFINE_FACTORY(GeneratorWorkerFactory, GeneratorWorker, "Generator worker factory", "GENERATOR_WORKER");
 }  // namespace cepgen
 
 #endif
@@ -34,7 +34,7 @@
 namespace cepgen {
   class Integrator;
   /// An integrator objects factory
-  DEFINE_FACTORY(IntegratorFactory, Integrator, "Integrators factory");
+  DEFINE_FACTORY(IntegratorFactory, Integrator, "Integrators factory", "INTEGRATOR");
 }  // namespace cepgen
 
 #endif
@@ -27,9 +27,11 @@
 /// Name of the object builder
 #define BUILDER_NAME(obj) obj##Builder
 /// Define a factory instance for the definition of modules
-#define DEFINE_FACTORY(name, obj_type, description)                 \
+/// \note Variadic arguments are the registration macros (stripped from their REGISTER_ prefix) populating this
+///  factory, as listed in the modules manifest
+#define DEFINE_FACTORY(name, obj_type, description, ...)            \
   struct name : public ModuleFactory<obj_type> {                    \
-    explicit name() : ModuleFactory(description) {}                 \
+    explicit name() : ModuleFactory(description, {__VA_ARGS__}) {}  \
     inline static name& get() {                                     \
       static name instance;                                         \
       return instance;                                              \
@@ -59,7 +61,7 @@ namespace cepgen {
     void registerModule(const std::string& name, const ParametersList& def_params = ParametersList()) {
       static_assert(std::is_base_of_v<T, U>,
                     "\n\n  *** Failed to register an object with improper inheritance into the factory. ***\n");
-      if (has(name)) {
+      if (map_.count(name) > 0) {
         std::ostringstream oss;
         oss << "\n\n  *** " << description_ << " detected a duplicate module registration for index/name \"" << name
             << "\"! ***\n";
@@ -100,15 +102,15 @@ namespace cepgen {
     /// \param[in] params Additional parameters to steer the description
     ParametersDescription describeParameters(int index, const ParametersList& params = ParametersList()) const;
 
-    std::vector<std::string> modules() const;           ///< List of modules registered in the database
+    std::vector<std::string> modules() const;  ///< List of all modules registered in the database (incl. add-ons)
     inline bool empty() const { return map_.empty(); }  ///< Is the database empty?
     inline size_t size() const { return map_.size(); }  ///< Multiplicity of modules registered in the database
 
     ///< List of index-to-string associations in the database
     inline const std::unordered_map<int, std::string>& indices() const { return indices_; }
 
-    /// Check if a named module is registered
-    inline bool has(const std::string& name) const { return map_.count(name) > 0; }
+    /// Check if a named module is registered (or can be imported from an add-on)
+    bool has(const std::string& name) const;
 
   private:
     /// Build a module with its parameters set
@@ -117,12 +119,14 @@ namespace cepgen {
       return std::make_unique<U>(params);
     }
     const std::string description_;                 ///< Factory name
+    const std::vector<std::string> macros_;         ///< Registration macros populating this factory
     std::unordered_map<std::string, Builder> map_;  ///< Database of modules handled by this instance
     std::unordered_map<std::string, ParametersDescription> params_map_;  ///< Default parameters associated with modules
     const ParametersDescription empty_params_desc_;                      ///< An empty parameters description
 
   protected:
-    explicit ModuleFactory(const std::string&);     ///< Hidden default constructor for singleton operations
+    /// Hidden default constructor for singleton operations
+    explicit ModuleFactory(const std::string& description, const std::vector<std::string>& macros = {});
     std::unordered_map<int, std::string> indices_;  ///< Index-to-map association map
   };
 }  // namespace cepgen
@@ -44,9 +44,9 @@ namespace cepgen {
   class CollinearFlux;
   class KTFlux;
   /// A collinear parton fluxes objects factory
-  DEFINE_FACTORY(CollinearFluxFactory, CollinearFlux, "Collinear parton flux estimators factory");
+  DEFINE_FACTORY(CollinearFluxFactory, CollinearFlux, "Collinear parton flux estimators factory", "COLLINEAR_FLUX");
   /// A KT-factorised parton fluxes objects factory
-  DEFINE_FACTORY(KTFluxFactory, KTFlux, "KT-factorised flux estimators factory");
+  DEFINE_FACTORY(KTFluxFactory, KTFlux, "KT-factorised flux estimators factory", "KT_FLUX");
 
   /// A generic parton fluxes objects factory
   struct PartonFluxFactory {
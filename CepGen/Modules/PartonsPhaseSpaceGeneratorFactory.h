@@ -36,7 +36,8 @@ namespace cepgen {
   /// A partons' phase space mapping algorithms factory
   DEFINE_FACTORY(PartonsPhaseSpaceGeneratorFactory,
                  PartonsPhaseSpaceGenerator,
-                 "Partons phase space generator factory");
+                 "Partons phase space generator factory",
+                 "PARTONS_PHASE_SPACE_GENERATOR");
 }  // namespace cepgen
 
 #endif
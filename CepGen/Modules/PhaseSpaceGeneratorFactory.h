@@ -34,7 +34,10 @@
 namespace cepgen {
   class PhaseSpaceGenerator;
   /// A phase space mapping algorithms factory
-  DEFINE_FACTORY(BasePhaseSpaceGeneratorFactory, PhaseSpaceGenerator, "Phase space generator factory");
+  DEFINE_FACTORY(BasePhaseSpaceGeneratorFactory,
+                 PhaseSpaceGenerator,
+                 "Phase space generator factory",
+                 "PHASE_SPACE_GENERATOR");
   struct PhaseSpaceGeneratorFactory final : BasePhaseSpaceGeneratorFactory {
     static PhaseSpaceGeneratorFactory& get();
     std::unique_ptr<PhaseSpaceGenerator> build(const ParametersList&) const override;
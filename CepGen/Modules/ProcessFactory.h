@@ -60,7 +60,7 @@ namespace cepgen::proc {
 
 namespace cepgen {
   /// A processes factory
-  DEFINE_FACTORY(ProcessFactory, proc::Process, "Physics processes factory");
+  DEFINE_FACTORY(ProcessFactory, proc::Process, "Physics processes factory", "PROCESS", "FORTRAN_PROCESS");
 }  // namespace cepgen
 
 #endif
@@ -37,7 +37,7 @@ namespace cepgen::utils {
 
 namespace cepgen {
   /// A random number generator algorithms factory
-  DEFINE_FACTORY(RandomGeneratorFactory, utils::RandomGenerator, "Random number generator factory");
+  DEFINE_FACTORY(RandomGeneratorFactory, utils::RandomGenerator, "Random number generator factory", "RANDOM_GENERATOR");
 }  // namespace cepgen
 
 #endif
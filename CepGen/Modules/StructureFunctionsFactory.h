@@ -52,9 +52,10 @@ namespace cepgen {
   /// A structure functions parameterisations factory
   DEFINE_FACTORY(StructureFunctionsFactory,
                  strfun::Parameterisation,
-                 "Nucleon structure functions parameterisations factory");
+                 "Nucleon structure functions parameterisations factory",
+                 "STRFUN");
   /// A sigma ratio parameterisations factory
-  DEFINE_FACTORY(SigmaRatiosFactory, sigrat::Parameterisation, "Sigma L/T parameterisations factory");
+  DEFINE_FACTORY(SigmaRatiosFactory, sigrat::Parameterisation, "Sigma L/T parameterisations factory", "SIGMA_RATIO");
 }  // namespace cepgen
 
 #endif
@@ -0,0 +1,77 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Physics_CompiledCuts_h
+#define CepGen_Physics_CompiledCuts_h
+
+#include <array>
+#include <functional>
+#include <unordered_map>
+
+#include "CepGen/Physics/Cuts.h"
+
+namespace cepgen {
+  class Kinematics;
+}  // namespace cepgen
+
+namespace cepgen::cuts {
+  /// Minimal (momenta-only) kinematic record of an event, on which compiled cuts are evaluated
+  struct KinematicRecord {
+    /// Extract the kinematic content of an event
+    /// \param[in] event Event to extract the kinematics from
+    /// \param[in] with_remnants Also extract the final state beam remnants (and their mothers' momenta)?
+    void fill(const Event& event, bool with_remnants);
+
+    std::vector<Momentum> central;                          ///< Central system momenta
+    std::vector<pdgid_t> central_ids;                       ///< Central system PDG identifiers
+    std::array<std::vector<Momentum>, 2> remnants;          ///< Final state beam remnants momenta
+    std::array<std::vector<double>, 2> remnants_mother_pz;  ///< Longitudinal momentum of the remnants' mothers
+  };
+
+  /// Reduced set of kinematic cuts, only holding the active restrictions of a kinematics definition
+  /// \note This object reproduces the acceptance of the central, per-particle, and remnants cuts of a CutsList
+  ///  object, without any Event object (and its particles maps) lookup
+  class Compiled {
+  public:
+    explicit Compiled(const Kinematics&);
+
+    bool contain(const KinematicRecord&) const;  ///< Is this kinematic record accepted by all cuts?
+    bool empty() const;                          ///< Is there any active cut to evaluate?
+    bool hasRemnantsCuts() const;                ///< Are remnants kinematics required for the evaluation?
+
+  private:
+    using SingleCheck = std::function<bool(const Momentum&)>;
+    using PairCheck = std::function<bool(const Momentum&, const Momentum&)>;
+    /// Active restrictions on a (multi-)particle system
+    struct System {
+      explicit System(const Central&);
+      bool empty() const { return single.empty() && sum.empty() && pair.empty(); }
+      bool contain(const std::vector<Momentum>&) const;  ///< Evaluate all cuts on a system of particles
+      bool contain(const Momentum&) const;               ///< Evaluate all cuts on a single-particle system
+      std::vector<SingleCheck> single;                   ///< Single-particle cuts
+      std::vector<SingleCheck> sum;                      ///< Cuts on the system total momentum
+      std::vector<PairCheck> pair;                       ///< Correlation cuts on the two leading particles
+    };
+    System central_;
+    std::unordered_map<pdgid_t, System> central_particles_;
+    std::array<bool, 2> dissociative_beams_{false, false};
+    Limits remnants_yj_, remnants_xi_;
+  };
+}  // namespace cepgen::cuts
+
+#endif
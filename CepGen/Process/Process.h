@@ -53,6 +53,13 @@ namespace cepgen::proc {
 
     // debugging utilities
     double weight(const std::vector<double>&);      ///< Compute the weight for a phase-space point
+    /// Compute the weights for a batch of phase-space points
+    /// \param[in] num_points Number of phase space points in the batch
+    /// \param[in] coordinates Coordinates of all points (ndim() consecutive values per point)
+    /// \param[out] weights Weights of all points
+    /// \note Only the weights are computed, the event content is left undefined. Processes may override this method
+    ///  to amortise the matrix element evaluation over the whole batch.
+    virtual void weightBatch(size_t num_points, const double* coordinates, double* weights);
     void dumpPoint(std::ostream* = nullptr) const;  ///< Dump the coordinate of the phase-space point being evaluated
     void dumpVariables(std::ostream* = nullptr) const;  ///< List all variables handled by this generic process
 
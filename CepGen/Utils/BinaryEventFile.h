@@ -0,0 +1,160 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_BinaryEventFile_h
+#define CepGen_Utils_BinaryEventFile_h
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "CepGen/Utils/Value.h"
+
+namespace cepgen {
+  class Event;
+}  // namespace cepgen
+
+namespace cepgen::utils {
+  class MappedFile;
+  /// Native, chunked binary storage of events
+  /// \note Events are grouped into chunks, in which all particles properties (roles, PDG ids, status, momenta,
+  ///  parentage, ...) and event metadata are stored as contiguous columns. Each chunk carries the names of its metadata
+  ///  keys, so that complete chunks can be recovered from files not properly closed. An index of all chunks, followed
+  ///  by a fixed-size trailer, is appended when closing the file.
+  namespace binary_event {
+    constexpr uint32_t VERSION = 2;  ///< Current binary format version
+    /// File header
+    struct FileHeader {
+      char magic[8];     ///< File magic ("CGEVENT")
+      uint32_t version;  ///< Format version
+      uint32_t flags;    ///< Reserved for future use
+    };
+    /// Chunk header, followed by all columns of the chunk, and the names (uint32 length and characters) of all metadata
+    /// keys populated in the chunk
+    struct ChunkHeader {
+      char magic[4];           ///< Chunk magic ("CHNK")
+      uint32_t num_events;     ///< Number of events in the chunk
+      uint32_t metadata_keys;  ///< Bitmask of metadata keys populated for at least one event of the chunk
+      uint32_t flags;          ///< Reserved for future use
+      uint64_t num_particles;  ///< Total number of particles in the chunk
+      uint64_t num_relations;  ///< Total number of parentage relations (mothers and children) in the chunk
+      uint64_t size;           ///< Size of the columns block, in bytes
+    };
+    /// Index entry of one chunk
+    struct IndexEntry {
+      uint64_t offset;       ///< Position of the chunk header in the file
+      uint64_t first_event;  ///< Index of the first event stored in the chunk
+    };
+    /// File trailer, following the chunks index
+    struct Trailer {
+      double cross_section;        ///< Process cross-section, in pb
+      double cross_section_error;  ///< Uncertainty on the process cross-section, in pb
+      uint64_t num_events;         ///< Total number of events in the file
+      uint64_t num_chunks;         ///< Number of chunks in the file
+      uint64_t index_offset;       ///< Position of the chunks index in the file
+      char magic[8];               ///< Trailer magic ("CGEVIDX")
+    };
+  }  // namespace binary_event
+
+  /// Writer of events into a native binary file
+  class BinaryEventWriter {
+  public:
+    /// Open a binary file for writing
+    /// \param[in] path Output file path
+    /// \param[in] chunk_size Maximal number of events per chunk
+    explicit BinaryEventWriter(const std::string& path, size_t chunk_size = 1000);
+    ~BinaryEventWriter();  ///< Flush the last chunk and write the file index (errors are only reported)
+
+    /// Specify the process cross-section and uncertainty, in pb
+    inline void setCrossSection(const Value& cross_section) { cross_section_ = cross_section; }
+    void write(const Event&);                                ///< Append an event to the current chunk
+    void close();                                            ///< Flush the last chunk, write the index, close the file
+    inline size_t numEvents() const { return num_events_; }  ///< Number of events written so far
+
+  private:
+    bool flushChunk();  ///< Write the current chunk to the file, and return the output stream state
+    bool finalise();    ///< Flush the last chunk, write the index, close the file, and return the output stream state
+
+    const std::string path_;
+    const size_t chunk_size_;
+    std::ofstream file_;
+    /// Columns of the chunk being filled
+    struct Chunk {
+      void clear();
+      std::vector<double> px, py, pz, energy;  ///< Particles 4-momenta
+      std::vector<int64_t> pdg_id;             ///< Particles (signed) PDG identifiers
+      std::vector<float> metadata;             ///< Events metadata values (all key slots, event-major)
+      std::vector<uint32_t> first_particle;    ///< Index of the first particle of each event
+      std::vector<uint32_t> metadata_keys;     ///< Metadata keys populated for each event
+      std::vector<int32_t> id;                 ///< Particles identifiers in their event
+      std::vector<float> polarisation;         ///< Particles longitudinal polarisations
+      std::vector<int32_t> status;             ///< Particles status
+      std::vector<uint32_t> first_relation;    ///< Index of the first parentage relation of each particle
+      std::vector<uint32_t> num_mothers;       ///< Number of mothers of each particle
+      std::vector<int32_t> relations;          ///< Identifiers of mothers and children of all particles
+      std::vector<int8_t> role;                ///< Particles roles
+      std::vector<uint8_t> compressed;         ///< Are events compressed?
+    } chunk_;
+    std::vector<binary_event::IndexEntry> index_;
+    size_t num_events_{0};
+    Value cross_section_;
+  };
+
+  /// Memory-mapped reader of events from a native binary file
+  /// \note Events are decoded in place from a read-only mapping of the file. Random access to any event is
+  ///  supported, and the reading operation can safely be performed from several threads on a single reader object.
+  class BinaryEventReader {
+  public:
+    explicit BinaryEventReader(const std::string& path);  ///< Map a binary file and parse its index
+    ~BinaryEventReader();
+
+    static bool isBinary(const std::string& path);  ///< Is a file a native binary events file?
+
+    inline size_t size() const { return num_events_; }                   ///< Number of events in the file
+    inline const Value& crossSection() const { return cross_section_; }  ///< Process cross-section, in pb
+    void read(size_t event_index, Event&) const;                         ///< Decode one event from the file
+
+  private:
+    /// Columns of one chunk, pointing to the mapped file content
+    struct Chunk {
+      size_t first_event{0}, num_events{0};
+      uint32_t metadata_keys{0};
+      std::vector<size_t> keys;  ///< Process-wide metadata slots for all metadata keys stored in the chunk
+      const double *px{nullptr}, *py{nullptr}, *pz{nullptr}, *energy{nullptr};
+      const int64_t* pdg_id{nullptr};
+      const float* metadata{nullptr};
+      const uint32_t *first_particle{nullptr}, *event_metadata_keys{nullptr};
+      const int32_t* id{nullptr};
+      const float* polarisation{nullptr};
+      const int32_t* status{nullptr};
+      const uint32_t *first_relation{nullptr}, *num_mothers{nullptr};
+      const int32_t* relations{nullptr};
+      const int8_t* role{nullptr};
+      const uint8_t* compressed{nullptr};
+    };
+    size_t parseChunk(size_t offset, size_t first_event);  ///< Parse a chunk header and map its columns
+
+    const std::unique_ptr<MappedFile> file_;
+    std::vector<Chunk> chunks_;
+    size_t num_events_{0};
+    Value cross_section_;
+  };
+}  // namespace cepgen::utils
+
+#endif
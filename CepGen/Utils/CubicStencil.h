@@ -0,0 +1,65 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_CubicStencil_h
+#define CepGen_Utils_CubicStencil_h
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace cepgen::utils {
+  /// Nodes and weights of a cubic (Catmull-Rom) interpolation along one axis of a grid
+  /// \note In the first and last cells, the missing outer node is replaced by its quadratic extrapolation from the
+  ///  three edge nodes. The interpolation thus goes through the edge nodes, and remains exact for quadratic functions
+  ///  over the whole grid.
+  struct CubicStencil {
+    /// Build the stencil for a point within a grid cell
+    /// \param[in] cell Index of the lower node of the cell (between 0 and num_nodes-2)
+    /// \param[in] t Position of the point within the cell (between 0 and 1)
+    /// \param[in] num_nodes Number of nodes along the axis (at least 4)
+    inline CubicStencil(size_t cell, double t, size_t num_nodes) {
+      const auto t2 = t * t, t3 = t2 * t;
+      weights = {0.5 * (-t3 + 2. * t2 - t),
+                 0.5 * (3. * t3 - 5. * t2 + 2.),
+                 0.5 * (-3. * t3 + 4. * t2 + t),
+                 0.5 * (t3 - t2)};
+      if (cell == 0) {  // node -1 replaced by 3*v(0) - 3*v(1) + v(2)
+        first = 0;
+        weights = {weights[1] + 3. * weights[0], weights[2] - 3. * weights[0], weights[3] + weights[0], 0.};
+      } else if (cell + 2 >= num_nodes) {  // node N replaced by 3*v(N-1) - 3*v(N-2) + v(N-3)
+        first = num_nodes - 4;
+        weights = {0., weights[0] + weights[3], weights[1] - 3. * weights[3], weights[2] + 3. * weights[3]};
+      } else
+        first = cell - 1;
+    }
+    /// Build the stencil for a point along a regularly-spaced axis
+    /// \param[in] pos Position of the point with respect to the first node, in units of the nodes spacing
+    /// \param[in] num_nodes Number of nodes along the axis (at least 4)
+    static inline CubicStencil regular(double pos, size_t num_nodes) {
+      const auto cell =
+          static_cast<size_t>(std::fmax(0., std::fmin(std::floor(pos), static_cast<double>(num_nodes) - 2.)));
+      return CubicStencil(cell, pos - cell, num_nodes);
+    }
+
+    size_t first{0};                  ///< Index of the first node
+    std::array<double, 4> weights{};  ///< Interpolation weights of the four consecutive nodes
+  };
+}  // namespace cepgen::utils
+
+#endif
@@ -28,38 +28,64 @@
 #endif
 
 #include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "CepGen/Utils/Limits.h"
 
 namespace cepgen {
+  namespace utils {
+    class MappedFile;
+  }  // namespace utils
   /// Interpolation type for the grid coordinates
   enum struct GridType { linear, logarithmic, square };
+  /// Interpolation scheme for the grid values
+  enum struct GridInterpolation { multilinear, cubic };
   /// A generic class for \f$\mathbb{R}^D\mapsto\mathbb{R}^N\f$ grid interpolation
+  /// \note All grid values are stored in a dense, contiguous array (one block per value, first coordinate running
+  ///  fastest), shared by the GSL splines for \f$D\le 2\f$. Higher-dimensional grids are interpolated directly from
+  ///  this storage, with a constant-time bin lookup for regularly-spaced coordinates.
   /// \tparam D Number of variables in the grid (dimension)
   /// \tparam N Number of values handled per point
   template <size_t D, size_t N = 1>
   class GridHandler {
   public:
-    explicit GridHandler(const GridType& grid_type);  ///< Build a grid interpolator from a grid type
+    /// Build a grid interpolator from a grid type
+    explicit GridHandler(const GridType& grid_type,
+                         const GridInterpolation& interpolation = GridInterpolation::multilinear);
     virtual ~GridHandler() = default;
 
     using coord_t = std::vector<double>;     ///< Coordinates container
+    using point_t = std::array<double, D>;   ///< Coordinates of a point to be evaluated
     using values_t = std::array<double, N>;  ///< Value(s) at a given coordinate
 
-    values_t eval(const coord_t& in_coords) const;  ///< Interpolate a point to a given coordinate
+    values_t eval(const point_t& in_coords) const;  ///< Interpolate a point to a given coordinate
+    /// Interpolate a collection of points
+    void eval(const std::vector<point_t>& in_coords, std::vector<values_t>& out) const;
 
-    void insert(const coord_t& coord, values_t value);                         ///< Insert a new value in the grid
-    inline std::map<coord_t, values_t> values() const { return values_raw_; }  ///< List of values in the grid
+    void insert(const coord_t& coord, values_t value);  ///< Insert a new value in the grid
+    std::map<coord_t, values_t> values() const;         ///< List of values in the grid
 
     void initialise();                         ///< Initialise the grid and all useful interpolators/accelerators
+    /// Store the (initialised) grid content into a binary file
+    /// \param[in] path Binary grid file path
+    /// \param[in] metadata Optional user-defined block stored alongside the grid (e.g. a grid provenance header)
+    void save(const std::string& path, const std::string& metadata = "") const;
+    /// Load and initialise the grid from a binary file
+    /// \note Grid values are read in place from a read-only memory mapping of the file
+    /// \return User-defined metadata block stored alongside the grid
+    std::string load(const std::string& path);
+    static bool isBinary(const std::string& path);  ///< Is the file a binary grid file?
+
     std::array<Limits, D> boundaries() const;  ///< Grid boundaries (collection of (min,max))
     std::array<double, D> min() const;         ///< Lowest bound of the grid coordinates
     std::array<double, D> max() const;         ///< Highest bound of the grid coordinates
 
   protected:
     const GridType grid_type_;                ///< Type of interpolation for the grid members
+    const GridInterpolation interpolation_;   ///< Interpolation scheme for the grid values
     std::map<coord_t, values_t> values_raw_;  ///< List of coordinates and associated value(s) in the grid
     /// Grid interpolation accelerator
     std::vector<std::unique_ptr<gsl_interp_accel, void (*)(gsl_interp_accel*)> > accelerators_;
@@ -68,18 +94,39 @@ namespace cepgen {
     /// Splines for bilinear interpolations
     std::vector<std::unique_ptr<gsl_spline2d, void (*)(gsl_spline2d*)> > splines_2d_;
 #endif
-    std::array<coord_t, D> coordinates_;               ///< Coordinates building up the grid
-    std::array<std::unique_ptr<double[]>, N> values_;  ///< Values for all points in the grid
+    std::array<coord_t, D> coordinates_;                ///< Coordinates building up the grid
+    std::vector<double> grid_;                          ///< Dense values storage for all points in the grid
+    std::shared_ptr<const utils::MappedFile> mapping_;  ///< Memory-mapped binary grid file (if loaded from file)
+    const double* values_data_{nullptr};                ///< Dense values for all points (from storage or mapping)
+    size_t num_nodes_{0};                               ///< Number of nodes in the grid (per value)
+    std::array<size_t, D> strides_{};                   ///< Storage stride for each coordinate
+    std::array<double, D> inv_steps_{};                 ///< Inverse step of regular coordinates (0 if irregular)
 
   private:
-    void findIndices(const coord_t& coord, coord_t& min, coord_t& max) const;  ///< Lower/upper indices for a coordinate
-    /// A single value in grid coordinates
-    struct grid_point_t : values_t {
-      grid_point_t(const values_t& arr) : values_t(arr) {}
-      grid_point_t operator*(double c) const;
-      grid_point_t operator+(const grid_point_t& rhs) const;
+    /// Binary grid file header, followed by the number of nodes (uint64) for each coordinate, the size (uint64) and
+    /// content of the user metadata block (padded to 8 bytes), all coordinates values, and the dense values block
+    /// (double)
+    struct BinaryHeader {
+      char magic[8];        ///< File magic ("CGIGRID")
+      uint32_t version;     ///< Format version
+      uint32_t dimension;   ///< Number of coordinates (D)
+      uint32_t num_values;  ///< Number of values per node (N)
+      uint32_t grid_type;   ///< Coordinates transformation
+    };
+    static constexpr uint32_t BINARY_VERSION = 2;  ///< Current binary grid format version
+    void setupAxes();                               ///< Compute the storage strides and steps of all coordinates
+    void initialiseInterpolators();                 ///< Initialise all interpolation objects from the dense storage
+    /// Interpolation nodes and weights along one coordinate
+    struct Stencil {
+      size_t size{0};                   ///< Number of nodes involved
+      std::array<size_t, 4> offsets{};  ///< Storage offsets of the nodes
+      std::array<double, 4> weights{};  ///< Interpolation weights of the nodes
     };
-    bool initialised_{false};  ///< Has the extrapolator been initialised?
+    point_t transform(const point_t&) const;                  ///< Convert user coordinates into grid coordinates
+    void locate(size_t dim, double, size_t&, double&) const;  ///< Lower node index and position in cell
+    Stencil stencil(size_t dim, double) const;                ///< Interpolation stencil along one coordinate
+    values_t evalDense(const point_t&) const;                 ///< Interpolate a point from the dense storage
+    bool initialised_{false};                                 ///< Has the extrapolator been initialised?
   };
 }  // namespace cepgen
 
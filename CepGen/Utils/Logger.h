@@ -1,6 +1,6 @@
 /*
  *  CepGen: a central exclusive processes event generator
- *  Copyright (C) 2015-2024  Laurent Forthomme
+ *  Copyright (C) 2015-2025  Laurent Forthomme
  *
  *  This program is free software: you can redistribute it and/or modify
  *  it under the terms of the GNU General Public License as published by
@@ -19,7 +19,9 @@
 #ifndef CepGen_Utils_Logger_h
 #define CepGen_Utils_Logger_h
 
+#include <atomic>
 #include <regex>
+#include <string_view>
 #include <vector>
 
 namespace cepgen::utils {
@@ -44,6 +46,30 @@ namespace cepgen::utils {
     /// \param[in] tmpl Module name to probe
     /// \param[in] lev Upper verbosity level
     bool passExceptionRule(const std::string& tmpl, const Level& lev) const;
+    /// Last exception rules matching result for one logging call site
+    struct ExceptionRuleCache {
+      std::string module;       ///< Last module name probed
+      size_t rules_version{0};  ///< Exception rules generation at the time of the last probe
+      bool matched{false};      ///< Last probe result
+    };
+    /// Is the module set to be displayed/logged? (call site-cached version)
+    /// \param[in] tmpl Module name to probe
+    /// \param[in] lev Upper verbosity level
+    /// \param[in] site_cache Accessor to the call site cache, only invoked if exception rules are to be evaluated
+    template <typename F>
+    inline bool passExceptionRule(std::string_view tmpl, const Level& lev, F&& site_cache) const {
+      if (level_ >= lev)
+        return true;
+      if (allowed_exc_.empty())
+        return false;
+      auto& cache = site_cache();
+      if (cache.rules_version != rules_version_ || cache.module != tmpl) {
+        cache.module = tmpl;
+        cache.matched = passExceptionRule(cache.module, lev);
+        cache.rules_version = rules_version_;
+      }
+      return cache.matched;
+    }
     inline Level level() const { return level_; }                  ///< Logging threshold
     inline void setLevel(Level level) { level_ = level; }          ///< Set the logging threshold
     inline bool extended() const { return extended_; }             ///< Also show extended information?
@@ -56,17 +82,22 @@ namespace cepgen::utils {
   private:
     explicit Logger(StreamHandler);  ///< Initialise a logging object
 
-    std::vector<std::regex> allowed_exc_;  ///< List of enabled logging modules
-    bool extended_{false};                 ///< Also print extra attributes?
-    Level level_{Level::information};      ///< Logging threshold for the output stream
-    StreamHandler output_{nullptr};        ///< Output stream to use for all logging operations
+    std::vector<std::regex> allowed_exc_;   ///< List of enabled logging modules
+    std::atomic<size_t> rules_version_{1};  ///< Generation of the exception rules, for call site caches invalidation
+    bool extended_{false};                  ///< Also print extra attributes?
+    Level level_{Level::information};       ///< Logging threshold for the output stream
+    StreamHandler output_{nullptr};         ///< Output stream to use for all logging operations
   };
 }  // namespace cepgen::utils
 namespace cepgen {
   std::ostream& operator<<(std::ostream& os, const utils::Logger::Level&);
 }
 
-#define CG_LOG_MATCH(str, type) cepgen::utils::Logger::get().passExceptionRule(str, cepgen::utils::Logger::Level::type)
+#define CG_LOG_MATCH(str, type)                                                                           \
+  cepgen::utils::Logger::get().passExceptionRule(str, cepgen::utils::Logger::Level::type, []() -> auto& { \
+    thread_local cepgen::utils::Logger::ExceptionRuleCache cache;                                         \
+    return cache;                                                                                         \
+  })
 #define CG_LOG_LEVEL(type) cepgen::utils::Logger::get().setLevel(cepgen::utils::Logger::Level::type)
 
 #endif
@@ -0,0 +1,49 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_MappedFile_h
+#define CepGen_Utils_MappedFile_h
+
+#include <string>
+#include <vector>
+
+namespace cepgen::utils {
+  /// Read-only memory mapping of a file content
+  /// \note Mapped pages are backed by the system page cache, hence shared among all processes (and threads) mapping
+  ///  the same file on a node. On platforms without POSIX memory mapping, the file content is read into a private
+  ///  buffer instead.
+  class MappedFile {
+  public:
+    explicit MappedFile(const std::string& path);  ///< Map the full content of a file
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    inline const std::string& path() const { return path_; }                     ///< Path to the mapped file
+    inline const char* data() const { return static_cast<const char*>(data_); }  ///< Start of the mapped region
+    inline size_t size() const { return size_; }                                 ///< Mapped region size (in bytes)
+
+  private:
+    const std::string path_;    ///< Path to the mapped file
+    void* data_{nullptr};       ///< Start of the mapped region
+    size_t size_{0};            ///< Size of the mapped region, in bytes
+    std::vector<char> buffer_;  ///< File content, if not mapped into memory
+  };
+}  // namespace cepgen::utils
+
+#endif
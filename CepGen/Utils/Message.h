@@ -205,10 +205,15 @@ namespace cepgen {
   (!CG_LOG_MATCH(mod, debug)) \
       ? cepgen::NullStream()  \
       : cepgen::LoggedMessage(mod, __FUNC__, cepgen::LoggedMessage::MessageType::debug, __FILE__, __LINE__)
+#ifdef CEPGEN_NO_DEBUG_LOOP
+/// In-loop debugging printouts compiled out (stream arguments are never evaluated)
+#define CG_DEBUG_LOOP(mod) true ? cepgen::NullStream() : cepgen::NullStream()
+#else
 #define CG_DEBUG_LOOP(mod)              \
   (!CG_LOG_MATCH(mod, debugInsideLoop)) \
       ? cepgen::NullStream()            \
       : cepgen::LoggedMessage(mod, __FUNC__, cepgen::LoggedMessage::MessageType::debug, __FILE__, __LINE__)
+#endif
 #define CG_WARNING(mod)         \
   (!CG_LOG_MATCH(mod, warning)) \
       ? cepgen::NullStream()    \
@@ -0,0 +1,74 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_RingBuffer_h
+#define CepGen_Utils_RingBuffer_h
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace cepgen::utils {
+  /// Bounded, lock-free single-producer/single-consumer queue
+  /// \note Only one thread at a time may push elements, and only one (possibly different) thread may pop them.
+  template <typename T>
+  class RingBuffer {
+  public:
+    /// Book the memory for a queue of a given capacity (rounded up to the next power of two)
+    explicit RingBuffer(size_t capacity) {
+      size_t size = 1;
+      while (size < capacity)
+        size <<= 1;
+      slots_.resize(size);
+      mask_ = size - 1;
+    }
+
+    inline size_t capacity() const { return slots_.size(); }  ///< Maximal number of elements in the queue
+    /// Is the queue empty?
+    inline bool empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
+
+    /// Append an element to the queue
+    /// \return False if the queue is full (in which case the element is left untouched)
+    bool push(T& element) {
+      const auto tail = tail_.load(std::memory_order_relaxed);
+      if (tail - head_.load(std::memory_order_acquire) == slots_.size())
+        return false;
+      slots_[tail & mask_] = std::move(element);
+      tail_.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+    /// Retrieve the oldest element of the queue
+    /// \return False if the queue is empty
+    bool pop(T& element) {
+      const auto head = head_.load(std::memory_order_relaxed);
+      if (head == tail_.load(std::memory_order_acquire))
+        return false;
+      element = std::move(slots_[head & mask_]);
+      head_.store(head + 1, std::memory_order_release);
+      return true;
+    }
+
+  private:
+    std::vector<T> slots_;
+    size_t mask_{0};
+    alignas(64) std::atomic<size_t> head_{0};  ///< Index of the next element to pop (consumer side)
+    alignas(64) std::atomic<size_t> tail_{0};  ///< Index of the next element to push (producer side)
+  };
+}  // namespace cepgen::utils
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Utils_TabulationCache_h
+#define CepGen_Utils_TabulationCache_h
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/GridHandler.h"
+
+namespace cepgen::utils {
+  /// Persistent storage of a tabulation for subsequent runs
+  /// \note Cache files are keyed by a hash of the tabulation configuration, and atomically published, as they may be
+  ///  concurrently read by other jobs. The full configuration is stored in each file, and checked upon retrieval.
+  class TabulationCache {
+  public:
+    /// Build a cache handler for a given tabulation
+    /// \param[in] directory Cache directory (caching disabled if empty)
+    /// \param[in] name Tabulation type, used as the cache file name prefix
+    /// \param[in] key Unique identifier of the tabulation configuration
+    explicit TabulationCache(const std::string& directory, const std::string& name, const std::string& key);
+
+    inline bool enabled() const { return !path_.empty(); }    ///< Is the tabulation caching enabled?
+    inline const std::string& path() const { return path_; }  ///< Path to the cache file
+
+    /// Retrieve a grid stored by a previous run
+    /// \return A boolean stating whether a cache file was found for this very configuration
+    template <size_t D, size_t N>
+    inline bool load(GridHandler<D, N>& grid) const {
+      if (!enabled() || !fileExists(path_))
+        return false;
+      if (grid.load(path_) != key_) {
+        rejected();
+        return false;
+      }
+      return true;
+    }
+    /// Store an initialised grid for subsequent runs
+    template <size_t D, size_t N>
+    inline void save(const GridHandler<D, N>& grid) const {
+      publish([this, &grid](const std::string& path) { grid.save(path, key_); });
+    }
+
+  private:
+    /// Write the cache file under a temporary name, then atomically move it to its final path
+    void publish(const std::function<void(const std::string&)>& writer) const;
+    void rejected() const;  ///< Report a cache file built for another configuration
+
+    const std::string directory_;
+    const std::string key_;
+    const std::string path_;
+  };
+
+  /// Process-wide collection of tabulations, shared by all identically configured instances
+  /// \tparam T Tabulation type
+  template <typename T>
+  class SharedTabulations {
+  public:
+    /// Retrieve (or build, if not yet known) the tabulation for a given configuration
+    /// \param[in] key Unique identifier of the tabulation configuration
+    /// \param[in] args Tabulation constructor arguments, only used when it is built
+    template <typename... Args>
+    static std::shared_ptr<T> get(const std::string& key, Args&&... args) {
+      auto& registry = SharedTabulations::registry();
+      const std::lock_guard<std::mutex> lock(registry.mutex);
+      if (auto it = registry.tables.find(key); it != registry.tables.end())
+        return it->second;
+      return registry.tables[key] = std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
+  private:
+    struct Registry {
+      std::mutex mutex;
+      std::unordered_map<std::string, std::shared_ptr<T> > tables;
+    };
+    static Registry& registry() {
+      static Registry registry;
+      return registry;
+    }
+  };
+}  // namespace cepgen::utils
+
+#endif
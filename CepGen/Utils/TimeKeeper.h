@@ -1,6 +1,6 @@
 /*
  *  CepGen: a central exclusive processes event generator
- *  Copyright (C) 2020-2024  Laurent Forthomme
+ *  Copyright (C) 2020-2025  Laurent Forthomme
  *
  *  This program is free software: you can redistribute it and/or modify
  *  it under the terms of the GNU General Public License as published by
@@ -19,48 +19,114 @@
 #ifndef CepGen_Utils_TimeKeeper_h
 #define CepGen_Utils_TimeKeeper_h
 
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "CepGen/Utils/Timer.h"
 
 #define CG_CONCAT(a, b) a##b
 #define CG_TICKER_NAME(a, b) CG_CONCAT(a, b)
-#define CG_TICKER(tmr) utils::TimeKeeper::Ticker CG_TICKER_NAME(ticker, __COUNTER__)(tmr, __PRETTY_FUNCTION__)
+#define CG_TICKER(tmr)                                             \
+  utils::TimeKeeper::Ticker CG_TICKER_NAME(ticker, __COUNTER__)(   \
+      tmr, [](const char* name) -> utils::TimeKeeper::Site& {      \
+        static const auto site_id = utils::TimeKeeper::site(name); \
+        thread_local utils::TimeKeeper::Site site(site_id);        \
+        return site;                                               \
+      }(__PRETTY_FUNCTION__))
 
 namespace cepgen::utils {
   /// Collection of clocks to benchmark execution blocks
+  /// \note Each monitored site is identified by a static integer identifier, and only aggregated counters (number
+  ///  of calls, sum, sum of squares, extrema) are kept for each of them. Counters are accumulated in per-thread
+  ///  blocks, and only merged when a summary is requested, allowing the timekeeping to stay enabled in production.
   class TimeKeeper {
+    class ThreadMonitor;
+
   public:
-    explicit TimeKeeper() = default;
+    explicit TimeKeeper();
+    ~TimeKeeper();
+
+    void clear();                 ///< Reset all counters and the timer
+    bool empty() const;           ///< Check if at least one monitor recorded something
+    std::string summary() const;  ///< Write a summary of all monitors
 
-    void clear();                                            ///< Reset all counters and the timer
-    inline bool empty() const { return monitors_.empty(); }  ///< Check if at least one monitor recorded something
-    std::string summary() const;                             ///< Write a summary of all monitors
+    /// Retrieve (or register if not yet known) the unique identifier of a monitoring site
+    static size_t site(const std::string& name);
 
     /// Count the time for one monitor
     /// \param[in] func monitor to increment
     /// \param[in] time increment, in second (< 0 to count since last timer reset)
     TimeKeeper& tick(const std::string& func, double time = -1.);
+    /// Count the time for one monitoring site
+    /// \param[in] site_id monitoring site identifier
+    /// \param[in] time increment, in second (< 0 to count since last timer reset)
+    TimeKeeper& tick(size_t site_id, double time = -1.);
 
     const Timer& timer() const;  ///< Local timer object
 
+    /// Per-thread handle on a monitoring site, caching the monitor it last fed
+    /// \note The monitor is only resolved again when the site is used with another timekeeper
+    class Site {
+    public:
+      explicit Site(size_t site_id) : id_(site_id) {}
+
+    private:
+      friend class TimeKeeper;
+      const size_t id_;
+      size_t keeper_uid_{0};  ///< Unique identifier of the timekeeper owning the cached monitor (0 if none)
+      ThreadMonitor* monitor_{nullptr};
+    };
+
     /// Scoped timekeeping utility
     class Ticker {
     public:
       explicit Ticker(TimeKeeper*, const std::string&);  ///< Build a named and scoped time ticker
+      explicit Ticker(TimeKeeper*, Site&);               ///< Build a scoped time ticker for a monitoring site
       ~Ticker();  ///< Ticker destructor to store the timing information to the parent timekeeper
 
     private:
       TimeKeeper* tk_{nullptr};
-      std::string name_;
+      size_t site_id_{0};
+      ThreadMonitor* monitor_{nullptr};  ///< Monitor already resolved for this site and thread, if any
       Timer tmr_;
     };
 
   private:
-    std::unordered_map<std::string, std::vector<float> > monitors_;
+    /// Aggregated timing information for one monitoring site
+    struct Monitor {
+      void merge(const Monitor& oth);  ///< Add all measurements of another monitor
+      size_t count{0};
+      double sum{0.}, sum2{0.}, min{0.}, max{0.};
+    };
+    /// Timing information for one monitoring site, only filled by its owning thread
+    /// \note Counters are relaxed atomics, as they may be read (or reset) concurrently when a summary is requested
+    class ThreadMonitor {
+    public:
+      void add(double time);  ///< Add one timing measurement
+      void clear();           ///< Reset all counters
+      Monitor get() const;    ///< Snapshot of all counters
+
+    private:
+      std::atomic<size_t> count_{0};
+      std::atomic<double> sum_{0.}, sum2_{0.}, min_{0.}, max_{0.};
+    };
+    /// Collection of monitors filled by one thread
+    struct ThreadMonitors {
+      std::mutex mutex;                    ///< Guard for the collection size, only locked when a new site is resolved
+      std::deque<ThreadMonitor> monitors;  ///< Monitors for all sites (never invalidated as the collection grows)
+    };
+    ThreadMonitors& threadMonitors();              ///< Retrieve (or create) the monitors block for the current thread
+    ThreadMonitor& threadMonitor(size_t site_id);  ///< Retrieve (or create) a site monitor for the current thread
+    ThreadMonitor& monitor(Site&);                 ///< Retrieve the monitor of a site for the current thread
+
+    const size_t uid_;  ///< Unique identifier of this timekeeper, used for the thread-local blocks lookup
+    std::vector<std::unique_ptr<ThreadMonitors> > thread_monitors_;
     Timer tmr_;
+    mutable std::mutex mutex_;  ///< Guard for the per-thread monitors blocks registry
   };
 }  // namespace cepgen::utils
 
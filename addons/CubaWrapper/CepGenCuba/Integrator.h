@@ -1,6 +1,6 @@
 /*
  *  CepGen: a central exclusive processes event generator
- *  Copyright (C) 2021-2024  Laurent Forthomme
+ *  Copyright (C) 2021-2025  Laurent Forthomme
  *
  *  This program is free software: you can redistribute it and/or modify
  *  it under the terms of the GNU General Public License as published by
@@ -19,6 +19,11 @@
 #ifndef CepGenCuba_CubaIntegrator_h
 #define CepGenCuba_CubaIntegrator_h
 
+#include <cuba.h>
+
+#include <exception>
+#include <memory>
+
 #include "CepGen/Integration/Integrator.h"
 
 namespace cepgen {
@@ -33,19 +38,39 @@ namespace cepgen::cuba {
     explicit Integrator(const ParametersList&);
 
     static ParametersDescription description();
-    static Integrand* gIntegrand;
 
     Value run(Integrand&, const std::vector<Limits>&) override;
 
   protected:
     virtual Value integrate() = 0;
+    static integrand_t cubaIntegrand();  ///< Batched integrand wrapper, as expected by the Cuba algorithms
+    inline void* userData() { return this; }  ///< User data to be passed to the Cuba algorithms
+    inline int numDimensions() const { return integrand_->size(); }  ///< Phase space dimension
 
     int ncomp_, nvec_;
     double epsrel_, epsabs_;
     int mineval_, maxeval_;
+    const int num_cores_, points_per_core_;
+
+  private:
+    friend int cuba_integrand(const int*, const double[], const int*, double[], void*, const int*);
+    static constexpr int ABORT = -999;  ///< Integrand return value aborting the Cuba integration
+
+    static void initialiseWorker(void*, const int*);  ///< Build a worker-local copy of the integrand
+    static void terminateWorker(void*, const int*);   ///< Release the worker-local copy of the integrand
+
+    Integrand* integrand_{nullptr};                ///< Integrand evaluated by the current (master or worker) process
+    std::unique_ptr<Integrand> worker_integrand_;  ///< Worker process-local copy of the integrand
+    long master_pid_{0};                           ///< Identifier of the process steering the integration
+    std::exception_ptr error_;                     ///< Exception raised by the integrand in the master process
   };
 
-  int cuba_integrand(const int* ndim, const double xx[], const int* /*ncomp*/, double ff[], void* /*userdata*/);
+  /// Cuba-compatible integrand wrapper, evaluating a batch of nvec points
+  /// \note Cuba algorithms expect an integrand_t-casted version of this function (see Integrator::cubaIntegrand).
+  ///  The user data is a pointer to the steering integrator. As this function is called from Cuba's C frames, it never
+  ///  throws, but rather aborts the integration on error.
+  int cuba_integrand(
+      const int* ndim, const double xx[], const int* ncomp, double ff[], void* userdata, const int* nvec);
 }  // namespace cepgen::cuba
 
 #endif
@@ -47,10 +47,10 @@ namespace cepgen::cuba {
       int nregions, neval, fail;
       double integral, error, prob;
 
-      Cuhre(gIntegrand->size(),
+      Cuhre(numDimensions(),
             ncomp_,
-            cuba_integrand,
-            nullptr,
+            cubaIntegrand(),
+            userData(),
             nvec_,
             epsrel_,
             epsabs_,
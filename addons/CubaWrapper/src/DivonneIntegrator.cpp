@@ -76,10 +76,10 @@ namespace cepgen::cuba {
       std::transform(
           given_.begin(), given_.end(), std::back_inserter(given_arr), [](auto& point) { return point.data(); });
 
-      Divonne(gIntegrand->size(),
+      Divonne(numDimensions(),
               ncomp_,
-              cuba_integrand,
-              nullptr,
+              cubaIntegrand(),
+              userData(),
               nvec_,
               epsrel_,
               epsabs_,
@@ -16,13 +16,15 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <unistd.h>
+
+#include <utility>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/Integrand.h"
 #include "CepGenCuba/Integrator.h"
 
 namespace cepgen::cuba {
-  Integrand* Integrator::gIntegrand = nullptr;
-
   Integrator::Integrator(const ParametersList& params)
       : cepgen::Integrator(params),
         ncomp_(steer<int>("ncomp")),
@@ -30,30 +32,83 @@ namespace cepgen::cuba {
         epsrel_(steer<double>("epsrel")),
         epsabs_(steer<double>("epsabs")),
         mineval_(steer<int>("mineval")),
-        maxeval_(steer<int>("maxeval")) {}
+        maxeval_(steer<int>("maxeval")),
+        num_cores_(steer<int>("numCores")),
+        points_per_core_(steer<int>("pointsPerCore")) {}
 
   Value Integrator::run(Integrand& integrand, const std::vector<Limits>& /*range*/) {
-    gIntegrand = &integrand;
-    return integrate();
+    if (integrand.size() == 0)
+      throw CG_FATAL("cuba:Integrator") << "Invalid integrand: phase space dimension must be positive.";
+    if (ncomp_ != 1)
+      throw CG_FATAL("cuba:Integrator") << "Only single-component integrands are supported, " << ncomp_
+                                        << " components requested.";
+    integrand_ = &integrand;
+    error_ = nullptr;
+    master_pid_ = ::getpid();
+    if (num_cores_ >= 0)  // otherwise, Cuba's default (or CUBACORES environment variable) is used
+      cubacores(&num_cores_, &points_per_core_);
+    cubainit(initialiseWorker, this);
+    cubaexit(terminateWorker, this);
+    const auto result = integrate();
+    cubainit(nullptr, nullptr);
+    cubaexit(nullptr, nullptr);
+    if (error_)  // integration aborted by the integrand, the original exception can now be propagated
+      std::rethrow_exception(std::exchange(error_, nullptr));
+    return result;
+  }
+
+  void Integrator::initialiseWorker(void* arg, const int* core) {
+    auto* integrator = static_cast<Integrator*>(arg);
+    if (::getpid() == integrator->master_pid_)  // master process keeps on evaluating the original integrand
+      return;
+    // worker processes are forked from the master, the integrand copy is only modified in their own address space
+    if (integrator->worker_integrand_ = integrator->integrand_->clone(*core + 1); integrator->worker_integrand_)
+      integrator->integrand_ = integrator->worker_integrand_.get();
+    CG_DEBUG("cuba:Integrator") << "Cuba worker #" << *core << " initialised with "
+                                << (integrator->worker_integrand_ ? "a local clone" : "a forked copy")
+                                << " of the integrand.";
+  }
+
+  void Integrator::terminateWorker(void* arg, const int*) {
+    if (auto* integrator = static_cast<Integrator*>(arg); ::getpid() != integrator->master_pid_)
+      integrator->worker_integrand_.reset();
+  }
+
+  integrand_t Integrator::cubaIntegrand() {
+    // Cuba is passing the number of points as an extra argument to the integrand
+    return reinterpret_cast<integrand_t>(reinterpret_cast<void (*)()>(cuba_integrand));
   }
 
   ParametersDescription Integrator::description() {
     auto desc = cepgen::Integrator::description();
     desc.setDescription("Cuba generic integration algorithm");
     desc.add("ncomp", 1).setDescription("number of components of the integrand");
-    desc.add("nvec", 1).setDescription("number of samples received by the integrand");
+    desc.add("nvec", 128).setDescription("maximum number of samples received by the integrand in one single call");
     desc.add("epsrel", 1.e-3).setDescription("requested relative accuracy");
     desc.add("epsabs", 1.e-12).setDescription("requested absolute accuracy");
     desc.add("mineval", 0).setDescription("minimum number of integrand evaluations required");
     desc.add("maxeval", 50'000).setDescription("(approximate) maximum number of integrand evaluations allowed");
+    desc.add("numCores", -1)
+        .setDescription("number of worker processes for the integrand evaluation (0 = serial, -1 = Cuba default)");
+    desc.add("pointsPerCore", 10'000).setDescription("maximal number of points sent to a worker process at once");
     return desc;
   }
 
-  int cuba_integrand(const int* ndim, const double xx[], const int* /*ncomp*/, double ff[], void* /*userdata*/) {
-    if (!Integrator::gIntegrand)
-      throw CG_FATAL("cuba_integrand") << "Integrand not set for the Cuba algorithm!";
-    //TODO: handle the non-[0,1] ranges
-    ff[0] = Integrator::gIntegrand->eval(std::vector<double>(xx, xx + *ndim));
+  int cuba_integrand(
+      const int* /*ndim*/, const double xx[], const int* ncomp, double ff[], void* userdata, const int* nvec) {
+    auto* integrator = static_cast<Integrator*>(userdata);
+    if (!integrator || !integrator->integrand_ || *ncomp != 1)  // should have been caught by Integrator::run
+      return Integrator::ABORT;
+    try {
+      //TODO: handle the non-[0,1] ranges
+      integrator->integrand_->evalBatch(*nvec, xx, ff);  // all nvec points are evaluated in one single call
+    } catch (...) {
+      if (::getpid() == integrator->master_pid_)  // rethrown once back from the Cuba algorithm
+        integrator->error_ = std::current_exception();
+      else  // worker process, the error can only be reported from here
+        CG_ERROR("cuba_integrand") << "Integrand evaluation failed in Cuba worker process " << ::getpid() << ".";
+      return Integrator::ABORT;
+    }
     return 0;
   }
 }  // namespace cepgen::cuba
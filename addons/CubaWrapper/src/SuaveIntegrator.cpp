@@ -50,10 +50,10 @@ namespace cepgen::cuba {
       int neval, fail, nregions;
       double integral, error, prob;
 
-      Suave(gIntegrand->size(),
+      Suave(numDimensions(),
             ncomp_,
-            cuba_integrand,
-            nullptr,
+            cubaIntegrand(),
+            userData(),
             nvec_,
             epsrel_,
             epsabs_,
@@ -51,10 +51,10 @@ namespace cepgen::cuba {
       int neval, fail;
       double integral, error, prob;
 
-      Vegas(gIntegrand->size(),
+      Vegas(numDimensions(),
             ncomp_,
-            cuba_integrand,
-            nullptr,
+            cubaIntegrand(),
+            userData(),
             nvec_,
             epsrel_,
             epsabs_,
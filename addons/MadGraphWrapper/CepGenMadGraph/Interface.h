@@ -30,6 +30,8 @@ namespace cepgen::mg5amc {
 
     static ParametersDescription description();
 
+    /// Generate (or retrieve from the cache) the process library
+    /// \return Path to the shared library to be loaded in the runtime environment
     std::string run() const;
 
     /// Retrieve a CepGen-compatible parameters list from a MadGraph parameters card
@@ -42,14 +44,22 @@ namespace cepgen::mg5amc {
     static std::unordered_map<std::string, spdgid_t> mg5_parts_;
 
     static void generateLibrary(const fs::path&, const fs::path&, const fs::path&);
+    static fs::path libraryName();  ///< Platform-dependent file name of the process library
 
     void parseExtraParticles();
-    void linkCards() const;
-    std::string prepareMadGraphProcess() const;
+    void linkCards(const fs::path& proc_dir, bool copy) const;
+    /// Run the mg5_aMC process generation into a standalone_cpp output directory
+    void generateProcess(const fs::path& proc_dir, const fs::path& card_path, bool keep_card) const;
+    std::string prepareMadGraphProcess(const fs::path& proc_dir) const;
+    /// Retrieve the PDG identifiers of the incoming and outgoing particles, defining all unknown particles
+    std::pair<std::vector<int>, std::vector<int> > processParticles() const;
+    std::string cacheKey() const;   ///< Unique identifier of the process generation/compilation directives
+    std::string runCached() const;  ///< Retrieve the process library from the cache, or build and publish it
 
     const std::string proc_;
     const std::string model_;
     const fs::path tmp_dir_;
+    const fs::path cache_dir_;
     const fs::path card_path_;
     const fs::path log_filename_;
     const fs::path standalone_cpp_path_;
@@ -40,6 +40,12 @@ namespace cepgen::mg5amc {
 
     virtual void initialise(const std::string&) = 0;
     virtual double eval() = 0;
+    /// Evaluate the matrix element for a batch of phase space points
+    /// \param[in] num_points Number of phase space points in the batch
+    /// \param[in] momenta Structure-of-arrays block of all external particles momenta, with component k (E, px, py, pz)
+    ///  of particle j for point i stored at index (4 * j + k) * num_points + i
+    /// \param[out] matrix_elements Matrix element values for all points
+    virtual void evalBatch(size_t num_points, const double* momenta, double* matrix_elements);
     virtual const std::vector<Momentum>& momenta() = 0;
 
     Process& setMomentum(size_t i, const Momentum& mom);
@@ -34,7 +34,7 @@
 namespace cepgen::mg5amc {
   class Process;
   /// A MadGraph process factory
-  DEFINE_FACTORY(ProcessFactory, Process, "MadGraph process definition factory");
+  DEFINE_FACTORY(ProcessFactory, Process, "MadGraph process definition factory", "MG5AMC_PROCESS");
 }  // namespace cepgen::mg5amc
 
 #endif
@@ -28,10 +28,21 @@
 
 #include <array>
 #include <fstream>
+#include <iomanip>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Physics/PDG.h"
 #include "CepGen/Utils/Caller.h"
+#include "CepGen/Utils/Hasher.h"
 #include "CepGen/Utils/String.h"
 #include "CepGenMadGraph/Interface.h"
 #include "CepGenMadGraph/Utils.h"
@@ -41,6 +52,39 @@ using namespace cepgen;
 using namespace cepgen::mg5amc;
 using namespace std::string_literals;
 
+namespace {
+  /// Optimisation flags for the process library compilation (loops over batched points are auto-vectorised)
+  constexpr const char* kLibraryOptimisationFlags = "-O3";
+
+  /// Exclusive advisory lock on a file, held for the lifetime of the object
+  class FileLock {
+  public:
+    explicit FileLock(const fs::path& path) {
+#ifndef _WIN32
+      if (fd_ = ::open(path.c_str(), O_CREAT | O_RDWR, 0644); fd_ < 0)
+        throw CG_FATAL("mg5amc:FileLock") << "Failed to open the lock file " << path << ": " << std::strerror(errno);
+      CG_DEBUG("mg5amc:FileLock") << "Waiting for the lock on " << path << ".";
+      while (::flock(fd_, LOCK_EX) != 0)
+        if (errno != EINTR) {
+          ::close(fd_);
+          throw CG_FATAL("mg5amc:FileLock") << "Failed to lock the file " << path << ": " << std::strerror(errno);
+        }
+#else
+      (void)path;
+#endif
+    }
+    ~FileLock() {
+#ifndef _WIN32
+      ::flock(fd_, LOCK_UN);
+      ::close(fd_);
+#endif
+    }
+
+  private:
+    int fd_{-1};
+  };
+}  // namespace
+
 std::unordered_map<std::string, spdgid_t> Interface::mg5_parts_ = {
     {"d", 1},     {"d~", -1},  {"u", 2},   {"u~", -2},   {"s", 3},      {"s~", -3},   {"c", 4},   {"c~", -4},
     {"b", 5},     {"b~", -5},  {"t", 6},   {"t~", -6},   {"e+", -11},   {"e-", 11},   {"ve", 12}, {"ve~", -12},
@@ -53,6 +97,7 @@ Interface::Interface(const ParametersList& params)
       proc_(steer<std::string>("process")),
       model_(steer<std::string>("model")),
       tmp_dir_(steerAs<std::string, fs::path>("tmpDir")),
+      cache_dir_(steerAs<std::string, fs::path>("cacheDirectory")),
       card_path_(steerAs<std::string, fs::path>("cardPath")),
       log_filename_(steer<std::string>("logFile")),
       standalone_cpp_path_(steerAs<std::string, fs::path>("standaloneCppPath")),
@@ -99,64 +144,115 @@ void Interface::parseExtraParticles() {
 }
 
 std::string Interface::run() const {
+  if (standalone_cpp_path_.empty() && !cache_dir_.empty())
+    return runCached();
   fs::path cpp_path, cg_proc;
   if (!standalone_cpp_path_.empty()) {
     CG_INFO("mg5amc:Interface:run") << "Running on a process already generated by mg5_aMC: " << standalone_cpp_path_;
     cpp_path = standalone_cpp_path_;
     cg_proc = tmp_dir_ / "cepgen_proc_interface.cpp";
   } else {
-    CG_INFO("mg5amc:Interface:run") << "Running the mg5_aMC process generation.";
-    std::vector<std::string> cmds;
-    if (!model_.empty()) {
-      cmds.emplace_back("set auto_convert_model T");
-      cmds.emplace_back("import model " + model_);
-    }
-    cmds.emplace_back(extra_part_definitions_);
-    cmds.emplace_back("generate " + proc_);
-    cmds.emplace_back("output standalone_cpp " + tmp_dir_.string());
     cpp_path = tmp_dir_;
-    const auto num_removed_files = remove_all(cpp_path);
-    CG_DEBUG("mg5amc:Interface:run") << "Removed " << utils::s("file", num_removed_files, true)
-                                     << " from process directory " << cpp_path << ".";
+    generateProcess(cpp_path, card_path_, true);
+    cg_proc = prepareMadGraphProcess(cpp_path);
+  }
+  const auto lib_path = libraryName();
+  generateLibrary(cg_proc, cpp_path, lib_path);
+  linkCards(tmp_dir_, false);
+  return lib_path;
+}
 
-    std::ofstream log(log_filename_, std::ios::app);  // appending at the end of the log
-    log << "\n\n*** mg5_aMC process generation ***\n\n";
-    log << utils::merge(runCommand(cmds, card_path_, true), "\n");
+std::string Interface::runCached() const {
+  const auto key = cacheKey();
+  const auto proc_dir = cache_dir_ / key, lib_path = proc_dir / libraryName();
+  if (std::error_code err; !fs::create_directories(cache_dir_, err) && err)
+    throw CG_FATAL("mg5amc:Interface:run") << "Failed to create the process libraries cache directory " << cache_dir_
+                                           << ": " << err.message() << ".";
+  {  // only one job may generate a given process library, all others wait for its publication
+    const FileLock lock(cache_dir_ / (key + ".lock"));
+    if (fs::exists(lib_path)) {
+      CG_INFO("mg5amc:Interface:run") << "Reusing the mg5_aMC process library " << lib_path << ".";
+      processParticles();
+    } else {
+      CG_INFO("mg5amc:Interface:run") << "No mg5_aMC process library found in cache for key '" << key << "'.";
+      // the process is generated and compiled into a job-specific staging directory, published once complete
+#ifndef _WIN32
+      const auto staging_id = std::to_string(::getpid());
+#else
+      const auto staging_id = "0"s;
+#endif
+      const auto staging_dir = cache_dir_ / (key + ".tmp" + staging_id);
+      fs::remove_all(staging_dir);
+      generateProcess(staging_dir, cache_dir_ / (key + ".tmp" + staging_id + ".dat"), false);
+      generateLibrary(prepareMadGraphProcess(staging_dir), staging_dir, staging_dir / libraryName());
+      fs::remove_all(proc_dir);  // remove any incomplete leftover
+      fs::rename(staging_dir, proc_dir);
+      CG_INFO("mg5amc:Interface:run") << "mg5_aMC process library published as " << lib_path << ".";
+    }
+  }
+  linkCards(proc_dir, true);
+  return lib_path;
+}
 
-    CG_INFO("mg5amc:Interface:run") << "Preparing the mg5_aMC process library.";
-    log << "\n\n*** mg5_aMC process library compilation ***\n\n";
-    cg_proc = prepareMadGraphProcess();
+std::string Interface::cacheKey() const {
+  std::ostringstream directives;
+  directives << MADGRAPH_BIN << "\n"
+             << CC_CFLAGS << " " << kLibraryOptimisationFlags << "\n"
+             << utils::readFile(MADGRAPH_PROC_TMPL) << "\n"
+             << model_ << "\n"
+             << extra_part_definitions_ << "\n"
+             << proc_ << "\n"
+             << model_parameters_.serialise();
+  std::ostringstream key;
+  key << normalise(proc_, model_) << "_" << std::hex << std::setw(16) << std::setfill('0')
+      << utils::Hasher<std::string, false>()(directives.str());
+  return key.str();
+}
+
+void Interface::generateProcess(const fs::path& proc_dir, const fs::path& card_path, bool keep_card) const {
+  CG_INFO("mg5amc:Interface:run") << "Running the mg5_aMC process generation.";
+  std::vector<std::string> cmds;
+  if (!model_.empty()) {
+    cmds.emplace_back("set auto_convert_model T");
+    cmds.emplace_back("import model " + model_);
   }
+  cmds.emplace_back(extra_part_definitions_);
+  cmds.emplace_back("generate " + proc_);
+  cmds.emplace_back("output standalone_cpp " + proc_dir.string());
+  const auto num_removed_files = remove_all(proc_dir);
+  CG_DEBUG("mg5amc:Interface:run") << "Removed " << utils::s("file", num_removed_files, true)
+                                   << " from process directory " << proc_dir << ".";
+
+  std::ofstream log(log_filename_, std::ios::app);  // appending at the end of the log
+  log << "\n\n*** mg5_aMC process generation ***\n\n";
+  log << utils::merge(runCommand(cmds, card_path, keep_card), "\n");
+  CG_INFO("mg5amc:Interface:run") << "Preparing the mg5_aMC process library.";
+}
 
+fs::path Interface::libraryName() {
 #ifdef _WIN32
-  fs::path lib_path = "CepGenMadGraphProcess.dll";
+  return "CepGenMadGraphProcess.dll";
 #else
-  fs::path lib_path = "libCepGenMadGraphProcess.so";
+  return "libCepGenMadGraphProcess.so";
 #endif
-
-  generateLibrary(cg_proc, cpp_path, lib_path);
-  linkCards();
-  return lib_path;
 }
 
-void Interface::linkCards() const {
-  for (const auto& f : fs::directory_iterator(tmp_dir_ / "Cards"))
+void Interface::linkCards(const fs::path& proc_dir, bool copy) const {
+  for (const auto& f : fs::directory_iterator(proc_dir / "Cards"))
     if (f.path().extension() == ".dat") {
       fs::path link_path = f.path().filename();
-      if (!exists(link_path))
+      if (exists(link_path))
+        continue;
+      if (copy)  // cards may be steered by the job, while cached ones are shared among all jobs
+        copy_file(f, link_path);
+      else
         create_symlink(f, link_path);
     }
-  CG_DEBUG("mg5amc:Interface:run") << "Created links in current directory for all cards in '" +
-                                          std::string(tmp_dir_ / "Cards") + "'.";
+  CG_DEBUG("mg5amc:Interface:run") << (copy ? "Copied" : "Created links") << " in current directory for all cards in '"
+                                   << std::string(proc_dir / "Cards") << "'.";
 }
 
-std::string Interface::prepareMadGraphProcess() const {
-  //--- open template file
-  std::ifstream tmpl_file(MADGRAPH_PROC_TMPL);
-  std::string tmpl = std::string(std::istreambuf_iterator(tmpl_file), std::istreambuf_iterator<char>());
-  std::ofstream log(log_filename_, std::ios::app);  // appending at the end of the log
-  log << "\n\n*** mg5_aMC process library compilation ***\n\n";
-
+std::pair<std::vector<int>, std::vector<int> > Interface::processParticles() const {
   const auto& parts = unpackProcessParticles(proc_);
   std::vector<int> in_parts, out_parts;
   for (const auto& in_part : parts.first) {
@@ -178,10 +274,21 @@ std::string Interface::prepareMadGraphProcess() const {
   CG_INFO("mg5amc:Interface.prepareMadGraphProcess") << "Unpacked process particles: "
                                                      << "incoming=" << in_parts << ", "
                                                      << "outgoing=" << out_parts << ".";
+  return {in_parts, out_parts};
+}
+
+std::string Interface::prepareMadGraphProcess(const fs::path& proc_dir) const {
+  //--- open template file
+  std::ifstream tmpl_file(MADGRAPH_PROC_TMPL);
+  std::string tmpl = std::string(std::istreambuf_iterator(tmpl_file), std::istreambuf_iterator<char>());
+  std::ofstream log(log_filename_, std::ios::app);  // appending at the end of the log
+  log << "\n\n*** mg5_aMC process library compilation ***\n\n";
+
+  const auto [in_parts, out_parts] = processParticles();
 
   const std::string process_description = proc_ + (!model_.empty() ? " (model: " + model_ + ")" : "");
 
-  std::string src_filename = tmp_dir_ / "cepgen_proc_interface.cpp";
+  std::string src_filename = proc_dir / "cepgen_proc_interface.cpp";
   std::ofstream src_file(src_filename);
   src_file << utils::replaceAll(tmpl,
                                 {{"XXX_PART1_XXX", std::to_string(in_parts[0])},
@@ -229,6 +336,7 @@ void Interface::generateLibrary(const fs::path& proc_path, const fs::path& in_pa
   {
     utils::Caller caller;
     const auto compilation_output = caller.call({CC_CFLAGS,
+                                                 kLibraryOptimisationFlags,
                                                  "-fPIC"s,
                                                  "-shared"s,
                                                  "-Wno-unused-variable"s,
@@ -308,6 +416,8 @@ ParametersDescription Interface::description() {
   desc.add("standaloneCppPath", ""s);
   desc.addAs<std::string>("tmpDir", fs::temp_directory_path() / "cepgen_mg5_aMC")
       .setDescription("Temporary path where to store the MadGraph_aMC process definition files");
+  desc.addAs<std::string>("cacheDirectory", fs::temp_directory_path() / "cepgen_mg5_cache")
+      .setDescription("if set, directory where the process libraries are cached and shared among jobs");
   desc.addAs<std::string>("logFile", fs::temp_directory_path() / "cepgen_mg5_aMC.log")
       .setDescription("Temporary path where to store the log for this run");
   desc.add("extraParticles", ParametersDescription{})
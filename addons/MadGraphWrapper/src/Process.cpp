@@ -42,6 +42,15 @@ Process& Process::setMomentum(size_t i, const Momentum& mom) {
   return *this;
 }
 
+void Process::evalBatch(size_t num_points, const double* momenta, double* matrix_elements) {
+  for (size_t i = 0; i < num_points; ++i) {
+    for (size_t j = 0; j < mom_.size(); ++j)
+      for (size_t k = 0; k < 4; ++k)
+        mom_[j][k] = momenta[(4 * j + k) * num_points + i];
+    matrix_elements[i] = eval();
+  }
+}
+
 cepgen::ParametersDescription Process::description() {
   auto desc = ParametersDescription();
   desc.setDescription("generic mg5_aMC@NLO process");
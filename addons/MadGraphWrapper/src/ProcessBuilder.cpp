@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <fstream>
 
 #include "CepGen/Core/Exception.h"
@@ -102,6 +103,13 @@ namespace cepgen::mg5amc {
         return 0.;
       if (!kinematics().cuts().central.contain(event()(Particle::Role::CentralSystem)))
         return 0.;
+      if (batching_) {  // only buffer the external momenta, matrix element is evaluated later for the whole batch
+        for (const auto* mom : {&q1(), &q2()})
+          batch_momenta_.insert(batch_momenta_.end(), {mom->energy(), mom->px(), mom->py(), mom->pz()});
+        for (size_t i = 0; i < phase_space_generator_->central().size(); ++i)
+          batch_momenta_.insert(batch_momenta_.end(), {pc(i).energy(), pc(i).px(), pc(i).py(), pc(i).pz()});
+        return std::pow(shat(), -2);
+      }
 
       CG_DEBUG_LOOP("mg5amc:ProcessBuilder:eval")
           << "Particles content:\n"
@@ -116,6 +124,39 @@ namespace cepgen::mg5amc {
       return 0.;
     }
 
+    /// Two-pass batch evaluation: phase space mapping for all points, then one matrix element call for the batch
+    void weightBatch(size_t num_points, const double* coordinates, double* weights) override {
+      const auto num_dimensions = ndim(), num_components = 4 * (2 + phase_space_generator_->central().size());
+      std::vector<double> coord(num_dimensions);
+      std::vector<size_t> points;  // indices of all points requiring a matrix element evaluation
+      batch_momenta_.clear();
+      batching_ = true;
+      for (size_t i = 0; i < num_points; ++i) {
+        std::copy(coordinates + i * num_dimensions, coordinates + (i + 1) * num_dimensions, coord.begin());
+        clearEvent();
+        const auto num_buffered = batch_momenta_.size();
+        if (weights[i] = weight(coord); utils::positive(weights[i]) && batch_momenta_.size() > num_buffered)
+          points.emplace_back(i);
+        else {
+          weights[i] = 0.;
+          batch_momenta_.resize(num_buffered);
+        }
+      }
+      batching_ = false;
+      if (points.empty())
+        return;
+      // transpose the buffered momenta into the structure-of-arrays layout expected by the process
+      const auto num_evaluated = points.size();
+      soa_momenta_.resize(num_components * num_evaluated);
+      for (size_t i = 0; i < num_evaluated; ++i)
+        for (size_t j = 0; j < num_components; ++j)
+          soa_momenta_[j * num_evaluated + i] = batch_momenta_[i * num_components + j];
+      matrix_elements_.resize(num_evaluated);
+      mg5_proc_->evalBatch(num_evaluated, soa_momenta_.data(), matrix_elements_.data());
+      for (size_t i = 0; i < num_evaluated; ++i)
+        weights[points[i]] *= utils::positive(matrix_elements_[i]) ? matrix_elements_[i] : 0.;
+    }
+
   private:
     void loadMG5Library() const {
       utils::AbortHandler();
@@ -132,6 +173,8 @@ namespace cepgen::mg5amc {
     }
 
     std::unique_ptr<mg5amc::Process> mg5_proc_;
+    bool batching_{false};  ///< Are phase space points being buffered for a batched matrix element evaluation?
+    std::vector<double> batch_momenta_, soa_momenta_, matrix_elements_;  ///< Batched evaluation buffers
   };
 }  // namespace cepgen::mg5amc
 using MadGraphProcessBuilder = mg5amc::ProcessBuilder;
@@ -34,6 +34,11 @@ namespace cepgen {
     return out;
   }
 
+  template <>
+  bool ModuleFactory<mg5amc::Process>::has(const std::string& name) const {
+    return map_.count(name) > 0;  // processes libraries are generated at runtime, never declared in the manifest
+  }
+
   template <>
   std::unique_ptr<mg5amc::Process> ModuleFactory<mg5amc::Process>::build(const std::string& name,
                                                                          const ParametersList& params) const {
@@ -88,6 +88,19 @@ public:
     return me[0];
   }
 
+  void evalBatch(size_t num_points, const double* momenta, double* matrix_elements) override {
+    const auto num_particles = mom_.size();
+    for (size_t i = 0; i < num_points; ++i) {
+      for (size_t j = 0; j < num_particles; ++j)
+        for (size_t k = 0; k < 4; ++k)
+          mom_[j][k] = momenta[(4 * j + k) * num_points + i];
+      proc_->setMomenta(mom_);
+      proc_->sigmaKin();
+      const double me = proc_->getMatrixElements()[0];
+      matrix_elements[i] = utils::positive(me) ? me : 0.;
+    }
+  }
+
   const std::vector<Momentum>& momenta() override {
     const auto& p4 = proc_->getMomenta();
     // cast it to the member attribute and return it
@@ -113,4 +113,4 @@ namespace cepgen::pythia8 {
   };
 }  // namespace cepgen::pythia8
 using Pythia8LHEFEventExporter = cepgen::pythia8::LHEFEventExporter;
-REGISTER_EXPORTER("lhef", Pythia8LHEFEventExporter);
+REGISTER_EXPORTER("lhef_pythia8", Pythia8LHEFEventExporter);
@@ -247,7 +247,8 @@ Particle& Pythia8Hadroniser::addParticle(Event& event,
     PDG::get().define(prop);
   }
   //--- add the particle to the event content
-  Particle& op = event.addParticle(static_cast<Particle::Role>(role));
+  // roles are transported as unsigned integers; restore the sign of the undefined role
+  Particle& op = event.addParticle(static_cast<Particle::Role>(static_cast<short>(role)));
   op.setPdgId(py_part.id());
   op.setStatus(py_part.isFinal()                                                    ? Particle::Status::FinalState
                : static_cast<Particle::Role>(role) == Particle::Role::CentralSystem ? Particle::Status::Propagator
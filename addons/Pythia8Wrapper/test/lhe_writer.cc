@@ -21,7 +21,7 @@ int main(int argc, char* argv[]) {
 
   // initialise the LHEF writer
   const auto lhef_mod =
-      cepgen::EventExporterFactory::get().build("lhef", cepgen::ParametersList().set("filename", output_file));
+      cepgen::EventExporterFactory::get().build("lhef_pythia8", cepgen::ParametersList().set("filename", output_file));
 
   // randomise the number of events to be written in the output file
   const auto rng = cepgen::RandomGeneratorFactory::get().build("stl");
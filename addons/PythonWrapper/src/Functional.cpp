@@ -24,6 +24,18 @@
 
 using namespace std::string_literals;
 
+namespace {
+  /// Hold the Python interpreter lock for the lifetime of the object (e.g. if released by a batched integrator)
+  class GILGuard {
+  public:
+    GILGuard() : state_(PyGILState_Ensure()) {}
+    ~GILGuard() { PyGILState_Release(state_); }
+
+  private:
+    const PyGILState_STATE state_;
+  };
+}  // namespace
+
 namespace cepgen::python {
   Functional::Functional(const ParametersList& params)
       : utils::Functional(params),
@@ -95,6 +107,7 @@ namespace cepgen::python {
   }
 
   double Functional::eval() const {
+    const GILGuard gil;
     const auto get_value = [this](const ObjectPtr& return_value) -> double {
       if (!return_value)
         throw PY_ERROR << "Invalid return type for function '" << name_ << "' call: " << return_value.get() << ".";
@@ -16,6 +16,8 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/Integrand.h"
 #include "CepGen/Integration/Integrator.h"
@@ -30,7 +32,9 @@ namespace cepgen::python {
   class Integrator final : public cepgen::Integrator {
   public:
     explicit Integrator(const ParametersList& params)
-        : cepgen::Integrator(params), env_(ParametersList().setName("python_integrator")) {
+        : cepgen::Integrator(params),
+          env_(ParametersList().setName("python_integrator")),
+          release_gil_(steer<bool>("releaseGIL")) {
       if (const auto cfg = ObjectPtr::importModule(steer<std::string>("module")); cfg) {
         if (func_ = cfg.attribute("integrate"); !func_ || !PyCallable_Check(func_.get()))
           throw PY_ERROR << "Failed to retrieve/cast the object to a Python functional.";
@@ -40,12 +44,19 @@ namespace cepgen::python {
 
     Value run(Integrand& integrand, const std::vector<Limits>& range) override {
       lims_ = ObjectPtr::make(range);
-      gIntegrand = &integrand;
+      integrand_ = &integrand;
       const auto iterations = steer<int>("iterations");
       const auto evals = steer<int>("evals");
-      PyMethodDef python_integrand = {"integrand", py_integrand, METH_VARARGS, "A python-wrapped integrand"};
+      static PyMethodDef python_integrand = {
+          "integrand",
+          py_integrand,
+          METH_VARARGS,
+          "A python-wrapped integrand, evaluated either for a single point (sequence of coordinates), or for a "
+          "batch of points (C-contiguous float64 buffer of shape (N, ndim), e.g. a NumPy array). In the latter "
+          "case, the N values are returned as a float64 memoryview, or written into the optional second buffer."};
+      const ObjectPtr self(PyCapsule_New(this, nullptr, nullptr));
       const ObjectPtr function(
-          PyCFunction_NewEx(&python_integrand, nullptr, ObjectPtr::make<std::string>("integrand").get()));
+          PyCFunction_NewEx(&python_integrand, self.get(), ObjectPtr::make<std::string>("integrand").get()));
       const auto value =
           lims_ ? func_(function.get(), static_cast<int>(integrand.size()), iterations, 1000, evals, lims_.get())
                 : func_(function.get(), static_cast<int>(integrand.size()), iterations, 1000, evals);
@@ -66,21 +77,96 @@ namespace cepgen::python {
           .setDescription("name of the Python module embedding the integrate() function");
       desc.add("iterations", 10);
       desc.add("evals", 1000);
+      desc.add("releaseGIL", true)
+          .setDescription("release the Python interpreter lock while a batch of points is evaluated by the integrand");
       return desc;
     }
-    static Integrand* gIntegrand;
 
   private:
-    Environment env_;
-    ObjectPtr func_{nullptr}, lims_{nullptr};
-    static PyObject* py_integrand(PyObject* /*self*/, PyObject* args) {
-      if (!gIntegrand)
+    /// Release the Python interpreter lock for the lifetime of the object
+    class GILRelease {
+    public:
+      GILRelease() : state_(PyEval_SaveThread()) {}
+      ~GILRelease() { PyEval_RestoreThread(state_); }
+
+    private:
+      PyThreadState* state_;
+    };
+    /// Scoped view on a contiguous buffer of doubles
+    struct BufferView : Py_buffer {
+      explicit BufferView(PyObject* obj, int flags) : valid(PyObject_GetBuffer(obj, this, flags) == 0) {}
+      ~BufferView() {
+        if (valid)
+          PyBuffer_Release(this);
+      }
+      bool doubles() const { return itemsize == sizeof(double) && (!format || std::strcmp(format, "d") == 0); }
+      const bool valid;
+    };
+
+    static PyObject* py_integrand(PyObject* self, PyObject* args) {
+      auto* integrator = static_cast<Integrator*>(PyCapsule_GetPointer(self, nullptr));
+      if (!integrator || !integrator->integrand_)
         throw CG_FATAL("python:Integrator") << "Integrand was not initialised.";
-      const auto c_args = ObjectPtr::wrap(PyTuple_GetItem(args, 0)).vector<double>();
-      return ObjectPtr::make<double>(gIntegrand->eval(c_args)).release();
+      auto* points = PyTuple_GetItem(args, 0);
+      if (!points || !PyObject_CheckBuffer(points)) {  // single point given as a sequence of coordinates
+        const auto c_args = ObjectPtr::wrap(points).vector<double>();
+        return ObjectPtr::make<double>(integrator->integrand_->eval(c_args)).release();
+      }
+      return integrator->evalBuffer(points, PyTuple_Size(args) > 1 ? PyTuple_GetItem(args, 1) : nullptr);
     }
+    /// Evaluate the integrand for all points of a (N, ndim) buffer, without any intermediate copy
+    PyObject* evalBuffer(PyObject* points, PyObject* output) {
+      const BufferView input(points, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT);
+      if (!input.valid)
+        return nullptr;
+      const auto num_dimensions = integrand_->size();
+      if (!input.doubles() || input.ndim < 1 || input.ndim > 2 ||
+          static_cast<size_t>(input.shape[input.ndim - 1]) != num_dimensions) {
+        PyErr_Format(PyExc_ValueError,
+                     "integrand expects a C-contiguous float64 buffer of shape (N, %zu)",
+                     num_dimensions);
+        return nullptr;
+      }
+      const size_t num_points = input.ndim == 2 ? input.shape[0] : 1;
+      const auto* coordinates = static_cast<const double*>(input.buf);
+      if (input.ndim == 1) {  // single point
+        double value;
+        evalBatch(1, coordinates, &value);
+        return PyFloat_FromDouble(value);
+      }
+      if (output) {  // user-provided output buffer
+        const BufferView values(output, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE);
+        if (!values.valid)
+          return nullptr;
+        if (!values.doubles() || static_cast<size_t>(values.len) != num_points * sizeof(double)) {
+          PyErr_Format(PyExc_ValueError, "output buffer should be a float64 buffer of size %zu", num_points);
+          return nullptr;
+        }
+        evalBatch(num_points, coordinates, static_cast<double*>(values.buf));
+        Py_INCREF(output);
+        return output;
+      }
+      const ObjectPtr values(PyBytes_FromStringAndSize(nullptr, num_points * sizeof(double)));
+      if (!values)
+        return nullptr;
+      evalBatch(num_points, coordinates, reinterpret_cast<double*>(PyBytes_AS_STRING(values.get())));
+      const ObjectPtr view(PyMemoryView_FromObject(values.get()));
+      return view ? PyObject_CallMethod(view.get(), "cast", "s", "d") : nullptr;
+    }
+    void evalBatch(size_t num_points, const double* coordinates, double* values) {
+      if (!release_gil_) {
+        integrand_->evalBatch(num_points, coordinates, values);
+        return;
+      }
+      const GILRelease release;  // integrand is evaluated without any Python object manipulation
+      integrand_->evalBatch(num_points, coordinates, values);
+    }
+
+    Environment env_;
+    const bool release_gil_;
+    ObjectPtr func_{nullptr}, lims_{nullptr};
+    Integrand* integrand_{nullptr};
   };
-  Integrand* Integrator::gIntegrand = nullptr;
 }  // namespace cepgen::python
 using PythonIntegrator = cepgen::python::Integrator;
 REGISTER_INTEGRATOR("python", PythonIntegrator);
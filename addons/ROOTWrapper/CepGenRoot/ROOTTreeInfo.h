@@ -68,7 +68,7 @@ namespace ROOT {
     static CepGenEvent load(TFile*, const std::string& events_tree = TREE_NAME);
     static CepGenEvent load(const std::string&, const std::string& events_tree = TREE_NAME);
 
-    cepgen::Event::EventMetadata metadata;
+    std::unordered_map<std::string, float> metadata;
     float gen_time{-1.};        ///< Event generation time
     float tot_time{-1.};        ///< Total event generation time
     float weight{-1.};          ///< Event weight
@@ -43,16 +43,16 @@ public:
   explicit ROOTHistsHandler(const ParametersList&);
   ~ROOTHistsHandler() override {
     // finalisation of the output file
-    for (const auto& [names, hist] : hists1d_)
-      hist->Write(names.c_str());
-    for (const auto& [names, hist] : hists2d_)
-      hist->Write(utils::merge(names, "_vs_").c_str());
-    for (const auto& [names, hist] : hists3d_)
-      hist->Write(utils::merge(names, "_vs_").c_str());
-    for (const auto& [names, hist] : profiles1d_)
-      hist->Write(utils::merge(names, "_vs_").c_str());
-    for (const auto& [names, hist] : profiles2d_)
-      hist->Write(utils::merge(names, "_vs_").c_str());
+    for (const auto& [vars, hist] : hists1d_)
+      hist->Write(utils::merge(vars.names, "_vs_").c_str());
+    for (const auto& [vars, hist] : hists2d_)
+      hist->Write(utils::merge(vars.names, "_vs_").c_str());
+    for (const auto& [vars, hist] : hists3d_)
+      hist->Write(utils::merge(vars.names, "_vs_").c_str());
+    for (const auto& [vars, hist] : profiles1d_)
+      hist->Write(utils::merge(vars.names, "_vs_").c_str());
+    for (const auto& [vars, hist] : profiles2d_)
+      hist->Write(utils::merge(vars.names, "_vs_").c_str());
     file_->Close();  // ROOT and its sumptuous memory management disallow the "delete" here
   }
 
@@ -77,37 +77,42 @@ public:
   void setCrossSection(const Value& cross_section) override { cross_section_ = cross_section; }
   bool operator<<(const Event& event) override {
     // increment the corresponding histograms
-    for (const auto& h_var : hists1d_)
-      h_var.second->Fill(browser_.get(event, h_var.first), cross_section_);
-    for (const auto& h_var : hists2d_)
-      h_var.second->Fill(browser_.get(event, h_var.first[0]), browser_.get(event, h_var.first[1]), cross_section_);
-    for (const auto& h_var : hists3d_)
-      h_var.second->Fill(browser_.get(event, h_var.first[0]),
-                         browser_.get(event, h_var.first[1]),
-                         browser_.get(event, h_var.first[2]),
-                         cross_section_);
-    for (const auto& h_var : profiles1d_)
-      h_var.second->Fill(browser_.get(event, h_var.first[0]), browser_.get(event, h_var.first[1]), cross_section_);
-    for (const auto& h_var : profiles2d_)
-      h_var.second->Fill(browser_.get(event, h_var.first[0]),
-                         browser_.get(event, h_var.first[1]),
-                         browser_.get(event, h_var.first[2]),
-                         cross_section_);
+    for (const auto& [vars, hist] : hists1d_)
+      hist->Fill(vars(0, event), cross_section_);
+    for (const auto& [vars, hist] : hists2d_)
+      hist->Fill(vars(0, event), vars(1, event), cross_section_);
+    for (const auto& [vars, hist] : hists3d_)
+      hist->Fill(vars(0, event), vars(1, event), vars(2, event), cross_section_);
+    for (const auto& [vars, hist] : profiles1d_)
+      hist->Fill(vars(0, event), vars(1, event), cross_section_);
+    for (const auto& [vars, hist] : profiles2d_)
+      hist->Fill(vars(0, event), vars(1, event), vars(2, event), cross_section_);
     return true;
   }
 
 private:
+  /// List of variables to be filled in a histogram, compiled once at booking time
+  struct Variables {
+    explicit Variables(const utils::EventBrowser& browser, const std::vector<std::string>& vars) : names(vars) {
+      for (const auto& var : vars)
+        accessors.emplace_back(browser.compile(var));
+    }
+    inline double operator()(size_t i, const Event& event) const { return accessors[i](event); }
+    std::vector<std::string> names;                        ///< Human-readable variables names
+    std::vector<utils::EventBrowser::Accessor> accessors;  ///< Compiled variables accessors
+  };
+
   const std::unique_ptr<TFile> file_;
-  std::vector<std::pair<std::string, TH1*> > hists1d_;
-  std::vector<std::pair<std::vector<std::string>, TH2*> > hists2d_;
-  std::vector<std::pair<std::vector<std::string>, TH3*> > hists3d_;
-  std::vector<std::pair<std::vector<std::string>, TProfile*> > profiles1d_;
-  std::vector<std::pair<std::vector<std::string>, TProfile2D*> > profiles2d_;
+  const utils::EventBrowser browser_;
+  std::vector<std::pair<Variables, TH1*> > hists1d_;
+  std::vector<std::pair<Variables, TH2*> > hists2d_;
+  std::vector<std::pair<Variables, TH3*> > hists3d_;
+  std::vector<std::pair<Variables, TProfile*> > profiles1d_;
+  std::vector<std::pair<Variables, TProfile2D*> > profiles2d_;
 
   const ParametersList variables_;
 
   Value cross_section_{1., 0.};
-  const utils::EventBrowser browser_;
 };
 
 ROOTHistsHandler::ROOTHistsHandler(const ParametersList& params)
@@ -130,8 +135,8 @@ ROOTHistsHandler::ROOTHistsHandler(const ParametersList& params)
       auto title = variable.get<std::string>("title"s);
       if (title.empty())
         title = utils::format("%s;%s;d#sigma/d(%s) (pb/bin)", key.c_str(), key.c_str(), key.c_str());
-      hists1d_.emplace_back(
-          std::make_pair(key, new TH1D(key.c_str(), title.c_str(), num_bins_x, x_range.min(), x_range.max())));
+      hists1d_.emplace_back(std::make_pair(
+          Variables(browser_, vars), new TH1D(key.c_str(), title.c_str(), num_bins_x, x_range.min(), x_range.max())));
       CG_INFO("ROOTHistsHandler") << "Booking a 1D histogram with " << utils::s("bin", num_bins_x) << " in range "
                                   << x_range << " for \"" << key << "\".";
       continue;
@@ -149,12 +154,13 @@ ROOTHistsHandler::ROOTHistsHandler(const ParametersList& params)
                               vars[0].c_str(),
                               vars[1].c_str());
       if (profile) {
-        profiles1d_.emplace_back(
-            std::make_pair(vars, new TProfile(key.c_str(), title.c_str(), num_bins_x, x_range.min(), x_range.max())));
+        profiles1d_.emplace_back(std::make_pair(
+            Variables(browser_, vars),
+            new TProfile(key.c_str(), title.c_str(), num_bins_x, x_range.min(), x_range.max())));
         CG_INFO("ROOTHistsHandler") << "Booking a 1D profile with " << utils::s("bin", num_bins_x, true) << " in range "
                                     << x_range << " for \"" << utils::merge(vars, " / ") << "\".";
       } else {
-        hists2d_.emplace_back(std::make_pair(vars,
+        hists2d_.emplace_back(std::make_pair(Variables(browser_, vars),
                                              new TH2D(key.c_str(),
                                                       title.c_str(),
                                                       num_bins_x,
@@ -185,7 +191,7 @@ ROOTHistsHandler::ROOTHistsHandler(const ParametersList& params)
                               vars[1].c_str(),
                               vars[2].c_str());
       if (profile) {
-        profiles2d_.emplace_back(std::make_pair(vars,
+        profiles2d_.emplace_back(std::make_pair(Variables(browser_, vars),
                                                 new TProfile2D(key.c_str(),
                                                                title.c_str(),
                                                                num_bins_x,
@@ -198,7 +204,7 @@ ROOTHistsHandler::ROOTHistsHandler(const ParametersList& params)
                                     << " in range x=" << x_range << " and y=" << y_range << " for \""
                                     << utils::merge(vars, " / ") << "\".";
       } else {
-        hists3d_.emplace_back(std::make_pair(vars,
+        hists3d_.emplace_back(std::make_pair(Variables(browser_, vars),
                                              new TH3D(key.c_str(),
                                                       title.c_str(),
                                                       num_bins_x,
@@ -183,7 +183,7 @@ void CepGenEvent::fill(const cepgen::Event& ev, bool compress) {
     role[np] = static_cast<int>(part.role());
     np++;
   }
-  metadata = ev.metadata;
+  metadata = ev.metadata.entries();
   tree_->Fill();
   clear();
 }
@@ -63,11 +63,20 @@ namespace cepgen {
     bool operator<<(const Event&) override;
 
   private:
+    using Accessors = std::vector<utils::EventBrowser::Accessor>;
+    /// Compile the list of variables to be filled in a histogram
+    Accessors compile(const std::vector<std::string>& vars) const {
+      Accessors out;
+      for (const auto& var : vars)
+        out.emplace_back(browser_.compile(var));
+      return out;
+    }
+
     std::ofstream file_;
-    std::vector<std::pair<std::string, YODA::Histo1D> > hists1d_;
-    std::vector<std::pair<std::vector<std::string>, YODA::Histo2D> > hists2d_;
-    std::vector<std::pair<std::vector<std::string>, YODA::Profile1D> > profiles1d_;
-    std::vector<std::pair<std::vector<std::string>, YODA::Profile2D> > profiles2d_;
+    std::vector<std::pair<Accessors, YODA::Histo1D> > hists1d_;
+    std::vector<std::pair<Accessors, YODA::Histo2D> > hists2d_;
+    std::vector<std::pair<Accessors, YODA::Profile1D> > profiles1d_;
+    std::vector<std::pair<Accessors, YODA::Profile2D> > profiles2d_;
     YODA::Counter weight_cnt_;
     const ParametersList variables_;
 
@@ -92,7 +101,8 @@ namespace cepgen {
       const bool profile = hvars.get<bool>("profile");
       if (vars.size() == 1) {  // 1D histogram
         const auto title = utils::format("d(sigma)/d(%s) (pb/bin)", key.c_str());
-        hists1d_.emplace_back(std::make_pair(key, YODA::Histo1D(nbins_x, xrange.min(), xrange.max(), key, title)));
+        hists1d_.emplace_back(
+            std::make_pair(compile(vars), YODA::Histo1D(nbins_x, xrange.min(), xrange.max(), key, title)));
         CG_INFO("YODAHistsHandler") << "Booking a histogram with " << utils::s("bin", nbins_x) << " in range " << xrange
                                     << " for \"" << vars[0] << "\".";
         continue;
@@ -103,12 +113,12 @@ namespace cepgen {
         const auto title = utils::format("d^2(sigma)/d(%s)/d(%s) (pb/bin)", vars[0].c_str(), vars[1].c_str());
         if (profile) {
           profiles1d_.emplace_back(
-              std::make_pair(vars, YODA::Profile1D(nbins_x, xrange.min(), xrange.max(), key, title)));
+              std::make_pair(compile(vars), YODA::Profile1D(nbins_x, xrange.min(), xrange.max(), key, title)));
           CG_INFO("YODAHistsHandler") << "Booking a 1D profile with " << utils::s("bin", nbins_x)
                                       << " in range x=" << xrange << " for \"" << utils::merge(vars, " / ") << "\".";
         } else {
           hists2d_.emplace_back(std::make_pair(
-              vars,
+              compile(vars),
               YODA::Histo2D(nbins_x, xrange.min(), xrange.max(), nbins_y, yrange.min(), yrange.max(), key, title)));
           CG_INFO("YODAHistsHandler") << "Booking a 2D correlation plot with " << utils::s("bin", nbins_x + nbins_y)
                                       << " in range x=" << xrange << " and y=" << yrange << " for \""
@@ -128,7 +138,7 @@ namespace cepgen {
                                          vars[1].c_str(),
                                          vars[2].c_str());
         profiles2d_.emplace_back(std::make_pair(
-            vars,
+            compile(vars),
             YODA::Profile2D(nbins_x, xrange.min(), xrange.max(), nbins_y, yrange.min(), yrange.max(), key, title)));
         CG_INFO("YODAHistsHandler") << "Booking a 2D profile"
                                     << " with " << utils::s("bin", nbins_x + nbins_y, true) << " in range x=" << xrange
@@ -156,23 +166,20 @@ namespace cepgen {
     // increment the corresponding histograms
     for (auto& h_var : hists1d_)
 #if defined(YODA_VERSION) && YODA_VERSION < 20000
-      h_var.second.fillBin(browser_.get(ev, h_var.first), cross_section_);
+      h_var.second.fillBin(h_var.first[0](ev), cross_section_);
 #else
-      h_var.second.fill(browser_.get(ev, h_var.first), cross_section_);
+      h_var.second.fill(h_var.first[0](ev), cross_section_);
 #endif
     for (auto& h_var : hists2d_)
 #if defined(YODA_VERSION) && YODA_VERSION < 20000
-      h_var.second.fillBin(browser_.get(ev, h_var.first[0]), browser_.get(ev, h_var.first[1]), cross_section_);
+      h_var.second.fillBin(h_var.first[0](ev), h_var.first[1](ev), cross_section_);
 #else
-      h_var.second.fill(browser_.get(ev, h_var.first[0]), browser_.get(ev, h_var.first[1]), cross_section_);
+      h_var.second.fill(h_var.first[0](ev), h_var.first[1](ev), cross_section_);
 #endif
     for (auto& h_var : profiles1d_)
-      h_var.second.fill(browser_.get(ev, h_var.first[0]), browser_.get(ev, h_var.first[1]), cross_section_);
+      h_var.second.fill(h_var.first[0](ev), h_var.first[1](ev), cross_section_);
     for (auto& h_var : profiles2d_)
-      h_var.second.fill(browser_.get(ev, h_var.first[0]),
-                        browser_.get(ev, h_var.first[1]),
-                        browser_.get(ev, h_var.first[2]),
-                        cross_section_);
+      h_var.second.fill(h_var.first[0](ev), h_var.first[1](ev), h_var.first[2](ev), cross_section_);
     weight_cnt_.fill(ev.metadata("weight"));
     return true;
   }
@@ -177,9 +177,30 @@ macro(cepgen_build mod_name)
     endif()" PARENT_SCOPE)
         endif()
         file(APPEND ${CEPGEN_ADDONS_FILE} "${mod_name}\n")
+        if(ARG_SOURCES)
+            cepgen_register_modules(${mod_name} ${sources})
+        endif()
     endif()
 endmacro()
 
+#----- list all modules registered in a library into the modules manifest
+#      (one "<library> <registration macro> <module name/index>" line per module)
+function(cepgen_register_modules mod_name)
+    foreach(_s ${ARGN})
+        file(STRINGS ${_s} registrations REGEX "^[ \t]*REGISTER_[A-Z0-9_]+\\(")
+        foreach(_r ${registrations})
+            if(_r MATCHES "REGISTER_([A-Z0-9_]+)\\(\"([^\" ]+)\"(, *([0-9]+) *,)?")
+                file(APPEND ${CEPGEN_MODULES_FILE} "${mod_name} ${CMAKE_MATCH_1} ${CMAKE_MATCH_2}\n")
+                if(CMAKE_MATCH_4)  # module also registered with an integer index
+                    file(APPEND ${CEPGEN_MODULES_FILE} "${mod_name} ${CMAKE_MATCH_1} ${CMAKE_MATCH_4}\n")
+                endif()
+            elseif(_r MATCHES "REGISTER_FORTRAN_PROCESS\\(([A-Za-z0-9_]+)")
+                file(APPEND ${CEPGEN_MODULES_FILE} "${mod_name} FORTRAN_PROCESS ${CMAKE_MATCH_1}\n")
+            endif()
+        endforeach()
+    endforeach()
+endfunction()
+
 macro(cepgen_add_sources)
     set(options)
     set(one_val)
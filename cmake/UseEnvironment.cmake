@@ -37,6 +37,16 @@ else()
   find_package(GSL COMPONENTS gsl gslcblas REQUIRED)
   list(APPEND CEPGEN_CORE_EXT GSL::gslcblas)
 endif()
+#--- searching for a threading library (multi-threaded event generation)
+find_package(Threads REQUIRED)
+list(APPEND CEPGEN_CORE_EXT Threads::Threads)
+#--- searching for zlib (compressed output streams)
+find_package(ZLIB QUIET)
+if(ZLIB_FOUND)
+  message(STATUS "zlib found in ${ZLIB_LIBRARIES}")
+  list(APPEND CEPGEN_CORE_EXT ZLIB::ZLIB)
+  list(APPEND CEPGEN_CORE_DEFS CEPGEN_ZLIB)
+endif()
 #--- searching for ROOT
 find_package(ROOT QUIET)
 if(ROOT_FOUND)
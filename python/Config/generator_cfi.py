@@ -10,5 +10,5 @@ generator = Parameters(
     numEvents = 100000,
     numPoints = 100,
     printEvery = 10000,
-    numThreads = 2,
+    numThreads = 1,
 )
@@ -16,7 +16,8 @@ def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, l
     limits = limits if len(limits) > 0 else num_dim * [(0., 1.)]
 
     def func(xarr):
-        return torch.from_numpy(np.array([f([float(x) for x in xvals]) for xvals in xarr.numpy()]))
+        # the whole (N, ndim) batch of points is evaluated in one single call
+        return torch.from_numpy(np.asarray(f(np.ascontiguousarray(xarr.numpy(), dtype=np.float64))))
 
     mc = MonteCarlo()
     res = mc.integrate(func, dim=num_dim, N=num_calls, integration_domain=limits, backend='torch')
@@ -25,5 +26,5 @@ def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, l
 
 if __name__ == '__main__':
     import math
-    print(integrate(lambda x: x[0]**2 + x[1]**2, 2, 10, 1000, 1000))
-    print(integrate(lambda x: math.sin(x[0]), 1, 10, 1000, 1000, [(0, math.pi)]))
+    print(integrate(lambda x: x[:, 0]**2 + x[:, 1]**2, 2, 10, 1000, 1000))
+    print(integrate(lambda x: np.sin(x[:, 0]), 1, 10, 1000, 1000, [(0, math.pi)]))
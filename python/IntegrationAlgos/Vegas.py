@@ -4,20 +4,23 @@
 #
 # Vegas integration algorithm interface
 
+import numpy as np
 import vegas
 
 
 def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, limits: list[tuple[float]]=[]):
     limits = limits if len(limits) > 0 else num_dim * [(0., 1.)]
     integ = vegas.Integrator(limits)
-    def f_pyarr(vars):
-        return f(vars.tolist())
-    integ(f_pyarr, nitn=num_iter, neval=num_warmup)
-    res = integ(f_pyarr, nitn=num_iter, neval=num_calls)
+    @vegas.batchintegrand
+    def f_batch(x):
+        # the whole (N, ndim) batch of points is evaluated in one single call
+        return np.asarray(f(np.ascontiguousarray(x, dtype=np.float64)))
+    integ(f_batch, nitn=num_iter, neval=num_warmup)
+    res = integ(f_batch, nitn=num_iter, neval=num_calls)
     return (res.mean, res.sdev)
 
 
 if __name__ == '__main__':
     import math
-    print(integrate(lambda x: x[0]**2 + x[1]**2, 2, 10, 1000, 1000))
-    print(integrate(lambda x: math.sin(x[0]), 1, 10, 1000, 1000, [(0, math.pi)]))
+    print(integrate(lambda x: x[:, 0]**2 + x[:, 1]**2, 2, 10, 1000, 1000))
+    print(integrate(lambda x: np.sin(x[:, 0]), 1, 10, 1000, 1000, [(0, math.pi)]))
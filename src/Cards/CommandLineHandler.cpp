@@ -137,6 +137,8 @@ public:
       runParameters()->generation().setNumThreads(generation_params.get<int>("nthreads"s));
     if (generation_params.has<int>("nprn"s))
       runParameters()->generation().setPrintEvery(generation_params.get<int>("nprn"s));
+    if (generation_params.has<std::string>("gridcache"s))
+      runParameters()->generation().setGridCache(generation_params.get<std::string>("gridcache"s));
     if (generation_params.has<int>("seed"s))
       runParameters()->integrator().set("seed", generation_params.get<int>("seed"s));
 
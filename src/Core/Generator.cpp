@@ -17,14 +17,17 @@
  */
 
 #include <chrono>
+#include <thread>
 
 #include "CepGen/Cards/Handler.h"
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/AsynchronousExporters.h"
 #include "CepGen/EventFilter/EventExporter.h"
 #include "CepGen/EventFilter/EventModifier.h"
 #include "CepGen/Generator.h"
+#include "CepGen/Integration/GridCache.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
 #include "CepGen/Modules/CardsHandlerFactory.h"
@@ -36,6 +39,28 @@
 
 using namespace cepgen;
 
+namespace {
+  /// Launch a task on a collection of generator workers, each of them running in its own thread
+  /// \note Any exception raised by one of the workers is propagated to the calling thread once all workers are joined
+  void runWorkers(const std::vector<GeneratorWorker*>& workers, const std::function<void(GeneratorWorker&)>& task) {
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(workers.size());
+    for (size_t i = 0; i < workers.size(); ++i)
+      threads.emplace_back([&workers, &exceptions, &task, i] {
+        try {
+          task(*workers.at(i));
+        } catch (...) {
+          exceptions[i] = std::current_exception();
+        }
+      });
+    for (auto& thread : threads)
+      thread.join();
+    for (const auto& exception : exceptions)
+      if (exception)
+        std::rethrow_exception(exception);
+  }
+}  // namespace
+
 Generator::Generator(bool safe_mode) : parameters_(new RunParameters) {
   static bool kInitialised = false;
   if (!kInitialised) {
@@ -54,6 +79,7 @@ Generator::~Generator() {
 
 void Generator::clearRun() {
   CG_DEBUG("Generator:clearRun") << "Run is set to be cleared.";
+  workers_.clear();
   worker_ = GeneratorWorkerFactory::get().build(parameters_->generation().parameters().get<ParametersList>("worker"));
   CG_DEBUG("Generator:clearRun") << "Initialised a generator worker with parameters: " << worker_->parameters() << ".";
   // destroy and recreate the integrator instance
@@ -83,6 +109,7 @@ RunParameters& Generator::runParameters() {
 }
 
 void Generator::setRunParameters(std::unique_ptr<RunParameters>& run_parameters) {
+  setAsynchronousExporters(nullptr);  // output modules are about to be released
   parameters_ = std::move(run_parameters);
 }
 
@@ -163,7 +190,13 @@ void Generator::integrate() {
   if (!integrator_)
     throw CG_FATAL("Generator:integrate") << "No integrator object was declared for the generator!";
 
-  cross_section_ = integrator_->integrate(worker_->integrand());
+  if (GridCache::enabled(*parameters_)) {  // try to retrieve the cross-section and grid from a previous run
+    if (const GridCache cache(*parameters_); !cache.loadIntegration(*integrator_, cross_section_)) {
+      cross_section_ = integrator_->integrate(worker_->integrand());
+      cache.saveIntegration(*integrator_, cross_section_);
+    }
+  } else
+    cross_section_ = integrator_->integrate(worker_->integrand());
 
   CG_DEBUG("Generator:integrate") << "Computed cross section: (" << cross_section_ << ") pb.";
 
@@ -186,10 +219,40 @@ void Generator::initialise() {
 
   // prepare the run parameters for event generation
   parameters_->initialiseModules();
-  worker_->initialise();
+  workers_.clear();
+  if (const auto num_threads = parameters_->generation().numThreads(); num_threads > 1) {
+    CG_INFO("Generator:initialise") << "Preparing " << num_threads << " generator workers for multi-threaded "
+                                    << "event generation.";
+    worker_->initialise();  // reference worker, whose generation parameters are shared with all other threads
+    std::vector<GeneratorWorker*> workers;
+    for (size_t i = 1; i < num_threads; ++i)
+      workers.emplace_back(workers_.emplace_back(buildWorker(i)).get());
+    runWorkers(workers, [this](GeneratorWorker& worker) { worker.initialiseFrom(*worker_); });
+  } else
+    worker_->initialise();
   initialised_ = true;
 }
 
+std::unique_ptr<GeneratorWorker> Generator::buildWorker(size_t thread_id) const {
+  auto worker_params = worker_->parameters();
+  if (worker_params.has<ParametersList>("randomGenerator")) {  // decorrelate the random number streams
+    auto& rng_params = worker_params.operator[]<ParametersList>("randomGenerator");
+    rng_params.set<unsigned long long>("seed", rng_params.get<unsigned long long>("seed") + thread_id);
+  }
+  auto worker = GeneratorWorkerFactory::get().build(worker_params);
+  worker->setRunParameters(parameters_.get());  // a new process clone is built for this worker
+  worker->setIntegrator(integrator_.get());
+  if (!parameters_->eventModifiersSequence().empty()) {  // event modification algorithms are not shared among threads
+    auto modifiers = worker->integrand().cloneEventModifiers(thread_id);
+    for (auto& modifier : modifiers)
+      modifier->setCrossSection(cross_section_);
+    worker->integrand().setEventModifiersSequence(std::move(modifiers));
+  }
+  CG_DEBUG("Generator:buildWorker") << "Generator worker for thread #" << thread_id << " built with parameters "
+                                    << worker->parameters() << ".";
+  return worker;
+}
+
 const Event& Generator::next() {
   if (!worker_ || !initialised_)
     initialise();
@@ -220,7 +283,24 @@ void Generator::generate(size_t num_events, const std::function<void(const proc:
 
   const utils::Timer tmr;
 
-  worker_->generate(num_events, callback);  // launch the event generation
+  if (const auto buffer_size = parameters_->generation().exportBufferSize();
+      buffer_size > 0 && !parameters_->eventExportersSequence().empty())
+    setAsynchronousExporters(
+        std::make_unique<AsynchronousExporters>(parameters_->eventExportersSequence(), buffer_size));
+
+  if (workers_.empty())
+    worker_->generate(num_events, callback);  // launch the event generation
+  else {  // launch the event generation on all threads
+    std::vector<GeneratorWorker*> workers{worker_.get()};
+    for (const auto& worker : workers_)
+      workers.emplace_back(worker.get());
+    CG_INFO("Generator") << "Launching the event generation on " << utils::s("thread", workers.size(), true) << ".";
+    runWorkers(workers, [&num_events, &callback](GeneratorWorker& worker) { worker.generate(num_events, callback); });
+  }
+  if (async_exporters_) {  // wait for all events to be written
+    async_exporters_->flush();
+    setAsynchronousExporters(nullptr);
+  }
 
   const double generation_time = tmr.elapsed();
   const double rate_ms = (parameters_->numGeneratedEvents() > 0)
@@ -233,6 +313,14 @@ void Generator::generate(size_t num_events, const std::function<void(const proc:
                        << "Equivalent luminosity: " << utils::format("%g", equivalent_luminosity) << " pb^-1.";
 }
 
+void Generator::setAsynchronousExporters(std::unique_ptr<AsynchronousExporters> exporters) {
+  if (worker_)
+    worker_->setAsynchronousExporters(exporters.get());
+  for (const auto& worker : workers_)
+    worker->setAsynchronousExporters(exporters.get());
+  async_exporters_ = std::move(exporters);
+}
+
 void Generator::generate(size_t num_events, const std::function<void(const Event&, size_t)>& callback) {
   generate(num_events, [this, &callback](const proc::Process& process) {
     if (callback)
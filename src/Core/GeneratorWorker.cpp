@@ -16,10 +16,13 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <mutex>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
 #include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/AsynchronousExporters.h"
 #include "CepGen/EventFilter/EventExporter.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
@@ -29,6 +32,10 @@
 
 using namespace cepgen;
 
+namespace {
+  std::mutex kStorageMutex;  ///< Guard for the run-wide event storage (exporters, callbacks, run statistics)
+}  // namespace
+
 GeneratorWorker::GeneratorWorker(const ParametersList& params) : SteeredObject(params) {}
 
 void GeneratorWorker::setRunParameters(const RunParameters* run_parameters) {
@@ -53,8 +60,10 @@ void GeneratorWorker::generate(size_t num_events, const std::function<void(const
   if (!run_params_)
     throw CG_FATAL("GeneratorWorker:generate") << "No steering parameters specified!";
   callback_proc_ = callback;
+  max_events_ = num_events;
   while (run_params_->numGeneratedEvents() < num_events)
     next();
+  max_events_ = 0;
 }
 
 bool GeneratorWorker::storeEvent() const {
@@ -64,15 +73,22 @@ bool GeneratorWorker::storeEvent() const {
     return true;
 
   const auto& event = integrand_->process().event();
+  std::lock_guard<std::mutex> lock(kStorageMutex);  // only one worker may feed the output modules at a time
+  if (max_events_ > 0 && run_params_->numGeneratedEvents() >= max_events_)
+    return false;  // run-wide target was reached by another worker in the meantime
   if (const auto num_events_generated = run_params_->numGeneratedEvents();
       (num_events_generated + 1) % run_params_->generation().printEvery() == 0)
     CG_DEBUG("GeneratorWorker:store") << utils::s("event", num_events_generated + 1, true) << " generated.";
   if (callback_proc_)
     callback_proc_(integrand_->process());
-  for (const auto& event_exporter : run_params_->eventExportersSequence())
-    if (!(*event_exporter << event))
+  if (async_exporters_) {  // events are written from background threads
+    if (!(*async_exporters_ << event))
       return false;
-  const_cast<RunParameters*>(run_params_)->addGenerationTime(event.metadata("time:total"));
+  } else
+    for (const auto& event_exporter : run_params_->eventExportersSequence())
+      if (!(*event_exporter << event))
+        return false;
+  const_cast<RunParameters*>(run_params_)->addGenerationTime(event.metadata(Event::EventMetadata::TIME_TOTAL));
   return true;
 }
 
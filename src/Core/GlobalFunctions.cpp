@@ -16,7 +16,11 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Generator.h"
@@ -39,6 +43,22 @@ namespace cepgen::utils {
 }
 
 namespace cepgen {
+  namespace {
+    /// Collection of add-ons to be loaded on demand, as declared in the modules manifest
+    struct ModulesManifest {
+      std::recursive_mutex mutex;
+      bool enabled{false};                                          ///< Are add-ons loaded on demand?
+      /// (Registration macro, module name/index)-to-library associations
+      std::multimap<std::pair<std::string, std::string>, std::string> providers;
+      std::set<std::string> libraries;                              ///< Add-on libraries not yet loaded into the RTE
+    };
+    constexpr const char* kCoreLibrary = "CepGen";  ///< Core library, always linked to the executables
+    ModulesManifest& modulesManifest() {
+      static ModulesManifest manifest;
+      return manifest;
+    }
+  }  // namespace
+
   static const auto os_independent_path = [](const std::string& path, bool match) -> std::string {
 #ifdef _WIN32
     return match ? path + ".dll" : path;
@@ -114,6 +134,57 @@ namespace cepgen {
     return false;
   }
 
+  bool loadModule(const std::string& name, const std::vector<std::string>& macros) {
+    auto& manifest = modulesManifest();
+    const std::lock_guard<std::recursive_mutex> lock(manifest.mutex);
+    if (!manifest.enabled || name.empty())
+      return false;
+    std::vector<std::string> libraries;
+    bool declared = false;
+    auto add_provider = [&manifest, &libraries, &declared](const std::string& library) {
+      declared = true;
+      if (manifest.libraries.count(library) > 0)
+        libraries.emplace_back(library);
+    };
+    if (macros.empty()) {  // any factory may hold this module
+      for (const auto& [key, library] : manifest.providers)
+        if (key.second == name)
+          add_provider(library);
+    } else  // only consider the modules registered into the requesting factory
+      for (const auto& macro : macros)
+        for (auto [it, end] = manifest.providers.equal_range({macro, name}); it != end; ++it)
+          add_provider(it->second);
+    if (!declared && !macros.empty() &&
+        std::any_of(manifest.providers.begin(), manifest.providers.end(), [&name](const auto& provider) {
+          return provider.first.second == name;
+        }))  // module only declared for other factories (e.g. a kt-flux probed as a collinear flux); nothing to load
+      return false;
+    if (!declared) {  // module not declared in the manifest (e.g. registered under a computed name); load everything
+      CG_DEBUG("loadModule") << "Module '" << name << "' not found in the modules manifest. "
+                             << "Loading all remaining add-ons: " << manifest.libraries << ".";
+      libraries = std::vector<std::string>(manifest.libraries.begin(), manifest.libraries.end());
+    }
+    bool loaded = false;
+    for (const auto& library : libraries) {
+      manifest.libraries.erase(library);  // only attempt to load each add-on once
+      loaded |= loadLibrary(library, true);
+    }
+    if (manifest.libraries.empty())
+      manifest.enabled = false;
+    return loaded;
+  }
+
+  void loadAllModules() {
+    auto& manifest = modulesManifest();
+    const std::lock_guard<std::recursive_mutex> lock(manifest.mutex);
+    if (!manifest.enabled)
+      return;
+    for (const auto& library : manifest.libraries)
+      loadLibrary(library, true);
+    manifest.libraries.clear();
+    manifest.enabled = false;
+  }
+
   bool callPath(const std::string& local_path, const std::function<bool(const std::string&)>& callback) {
     if (search_paths.empty()) {
       CG_WARNING("callPath") << "List of search paths is empty.";
@@ -148,18 +219,42 @@ namespace cepgen {
                          << " are defined in the runtime environment.\n\t"
                          << "Make sure the path to the MCD file is correct.";
 
-    std::string addons_file;
+    std::string addons_file, modules_file;
     for (const auto& search_path : search_paths) {
-      if (const fs::path the_path{search_path}; addons_file.empty() && utils::fileExists(the_path / "CepGenAddOns.txt"))
+      const fs::path the_path{search_path};
+      if (addons_file.empty() && utils::fileExists(the_path / "CepGenAddOns.txt"))
         addons_file = the_path / "CepGenAddOns.txt";
+      if (modules_file.empty() && utils::fileExists(the_path / "CepGenModules.txt"))
+        modules_file = the_path / "CepGenModules.txt";
       utils::env::append("LD_LIBRARY_PATH", search_path);
     }
 
     // load all necessary modules
-    if (!safe_mode && !addons_file.empty())
-      for (const auto& lib : utils::split(utils::readFile(addons_file), '\n'))
-        loadLibrary(lib, true);
-    loadLibrary("CepGenProcesses", true);
+    if (!safe_mode && !modules_file.empty()) {  // add-ons are only loaded when one of their modules is requested
+      auto& manifest = modulesManifest();
+      const std::lock_guard<std::recursive_mutex> lock(manifest.mutex);
+      manifest.providers.clear();
+      for (const auto& line : utils::split(utils::readFile(modules_file), '\n')) {
+        // each line of the manifest is formatted as "<library> <registration macro> <module name/index>"
+        if (const auto fields = utils::split(line, ' ', true); fields.size() == 3) {
+          manifest.providers.emplace(std::make_pair(fields.at(1), fields.at(2)), fields.at(0));
+          if (fields.at(0) != kCoreLibrary)
+            manifest.libraries.insert(fields.at(0));
+        }
+      }
+      if (!addons_file.empty())  // also consider add-ons without any module declared in the manifest
+        for (const auto& lib : utils::split(utils::readFile(addons_file), '\n'))
+          if (!lib.empty() && lib != kCoreLibrary)
+            manifest.libraries.insert(lib);
+      manifest.enabled = !manifest.libraries.empty();
+      CG_DEBUG("initialise") << "Modules manifest parsed from '" << modules_file << "'. "
+                             << utils::s("add-on", manifest.libraries.size(), true) << " to be loaded on demand.";
+    } else {
+      if (!safe_mode && !addons_file.empty())
+        for (const auto& lib : utils::split(utils::readFile(addons_file), '\n'))
+          loadLibrary(lib, true);
+      loadLibrary("CepGenProcesses", true);
+    }
     if (!invalid_libraries.empty())
       CG_WARNING("init") << "Failed to load the following libraries:\n\t" << invalid_libraries << ".";
 
@@ -176,6 +271,8 @@ namespace cepgen {
         log << " with " << utils::s("add-on", loaded_libraries.size(), true) << ":\n\t" << libraries << ".\n\t";
       } else
         log << ". ";
+      if (const auto& manifest = modulesManifest(); manifest.enabled)
+        log << utils::s("add-on", manifest.libraries.size(), true) << " available on demand. ";
       log << "Greetings!";
     });
   }
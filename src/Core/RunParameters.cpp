@@ -51,7 +51,7 @@ RunParameters::RunParameters(RunParameters& param)
       evt_exporters_(std::move(param.evt_exporters_)),
       taming_functions_(std::move(param.taming_functions_)),
       total_gen_time_(param.total_gen_time_),
-      num_gen_events_(param.num_gen_events_),
+      num_gen_events_(param.num_gen_events_.load()),
       integrator_(param.integrator_),
       generation_(param.generation_),
       timer_(std::move(param.timer_)) {}
@@ -59,7 +59,7 @@ RunParameters::RunParameters(RunParameters& param)
 RunParameters::RunParameters(const RunParameters& param)
     : SteeredObject(param),
       total_gen_time_(param.total_gen_time_),
-      num_gen_events_(param.num_gen_events_),
+      num_gen_events_(param.num_gen_events_.load()),
       integrator_(param.integrator_),
       generation_(param.generation_) {}
 
@@ -71,7 +71,7 @@ RunParameters& RunParameters::operator=(RunParameters param) {
   evt_exporters_ = std::move(param.evt_exporters_);
   taming_functions_ = std::move(param.taming_functions_);
   total_gen_time_ = param.total_gen_time_;
-  num_gen_events_ = param.num_gen_events_;
+  num_gen_events_ = param.num_gen_events_.load();
   integrator_ = param.integrator_;
   generation_ = param.generation_;
   timer_ = std::move(param.timer_);
@@ -224,6 +224,8 @@ namespace cepgen {
        << param.generation_.parameters().get<ParametersList>("worker").print(true) << "\n";
     if (param.generation_.numThreads() > 1)
       os << std::setw(wt) << "Number of threads" << param.generation_.numThreads() << "\n";
+    if (!param.generation_.gridCache().empty())
+      os << std::setw(wt) << "Grids cache directory" << param.generation_.gridCache() << "\n";
     os << std::setw(wt) << "Number of points to try per bin" << param.generation_.numPoints() << "\n"
        << std::setw(wt) << "Verbosity level " << utils::Logger::get().level() << "\n";
     const auto& kin = param.process().kinematics();
@@ -296,7 +298,9 @@ RunParameters::Generation::Generation(const ParametersList& params) : SteeredObj
       .add("targetLumi"s, target_lumi_)
       .add("symmetrise"s, symmetrise_)
       .add("numThreads"s, num_threads_)
-      .add("numPoints"s, num_points_);
+      .add("numPoints"s, num_points_)
+      .add("gridCache"s, grid_cache_)
+      .add("exportBufferSize"s, export_buffer_size_);
 }
 
 ParametersDescription RunParameters::Generation::description() {
@@ -307,7 +311,12 @@ ParametersDescription RunParameters::Generation::description() {
   desc.add("printEvery"s, 10'000).setDescription("Printing frequency for the events content");
   desc.add("targetLumi"s, -1.).setDescription("Target luminosity (in pb-1) to reach for this run");
   desc.add("symmetrise"s, false).setDescription("Are events to be symmetric wrt beam collinear axis");
-  desc.add("numThreads"s, 1).setDescription("Number of threads to use for event generation");
+  desc.add("numThreads"s, 1)
+      .setDescription("Number of threads to use for event generation (each with its own process and worker clone)");
   desc.add("numPoints"s, 100);
+  desc.add("gridCache"s, ""s)
+      .setDescription("Directory where integration/generation grids are cached and reused across identical runs");
+  desc.add("exportBufferSize"s, 0)
+      .setDescription("Events buffer size of each output module written from its own thread (0 = synchronous output)");
   return desc;
 }
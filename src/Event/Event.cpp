@@ -18,6 +18,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Event/Event.h"
@@ -100,7 +103,7 @@ void Event::freeze() {
     event_content_.op2 = particles_[Particle::Role::OutgoingBeam2].size();
 }
 
-void Event::restore() {
+void Event::restore() {  // simple size reset of the fixed role slots, no reallocation involved
   if (particles_.count(Particle::Role::CentralSystem) > 0)
     particles_[Particle::Role::CentralSystem].resize(event_content_.cs);
   if (particles_.count(Particle::Role::OutgoingBeam1) > 0)
@@ -161,17 +164,15 @@ Event Event::compress() const {
 }
 
 ParticlesRefs Event::operator[](Particle::Role role) {
+  auto& parts_by_role = particles_[role];
   ParticlesRefs out;
-  for (auto& part : particles_[role])
+  out.reserve(parts_by_role.size());
+  for (auto& part : parts_by_role)
     out.emplace_back(std::ref(part));
   return out;
 }
 
-const Particles& Event::operator()(Particle::Role role) const {
-  if (particles_.count(role) == 0)
-    throw CG_FATAL("Event") << "Failed to retrieve a particle with " << role << " role.";
-  return particles_.at(role);
-}
+const Particles& Event::operator()(Particle::Role role) const { return particles_.at(role); }
 
 ParticlesIds Event::ids(Particle::Role role) const {
   ParticlesIds out;
@@ -183,13 +184,13 @@ ParticlesIds Event::ids(Particle::Role role) const {
 }
 
 Particle& Event::oneWithRole(Particle::Role role) {
-  const auto parts_by_role = operator[](role);
+  auto& parts_by_role = particles_[role];
   if (parts_by_role.empty())
     throw CG_FATAL("Event") << "No particle retrieved with " << role << " role.";
   if (parts_by_role.size() > 1)
     throw CG_FATAL("Event") << "More than one particle with " << role << " role: " << parts_by_role.size()
                             << " particles.";
-  return parts_by_role.front().get();
+  return parts_by_role.front();
 }
 
 const Particle& Event::oneWithRole(Particle::Role role) const {
@@ -317,7 +318,7 @@ void Event::updateRoles() {
 
 ParticleRef Event::addParticle(Particle& particle, bool replace) {
   CG_DEBUG_LOOP("Event") << "Particle with PDGid = " << particle.integerPdgId() << " has role " << particle.role();
-  if (static_cast<int>(particle.role()) <= 0)
+  if (particle.role() != Particle::Role::UnknownRole && static_cast<int>(particle.role()) <= 0)
     throw CG_FATAL("Event") << "Trying to add a particle with role=" << static_cast<int>(particle.role()) << ".";
 
   auto& part_with_same_role = particles_[particle.role()];  // list of particles with the same role
@@ -491,9 +492,83 @@ namespace cepgen {
   }
 }  // namespace cepgen
 
-Event::EventMetadata::EventMetadata()
-    : std::unordered_map<std::string, float>{{"time:generation"s, -1.f},
-                                             {"time:total"s, -1.f},
-                                             {"weight"s, 1.f},
-                                             {"alphaEM"s, constants::ALPHA_EM},
-                                             {"alphaS"s, constants::ALPHA_QCD}} {}
+namespace {
+  /// Process-wide registry of all metadata keys
+  struct MetadataRegistry {
+    static MetadataRegistry& get() {
+      static MetadataRegistry registry;
+      return registry;
+    }
+    /// Slot of a key, or the number of registered keys if not found (registry must be locked by the caller)
+    size_t find(const std::string& key) const {
+      return std::distance(keys.begin(), std::find(keys.begin(), keys.end(), key));
+    }
+    std::shared_mutex mutex;
+    std::vector<std::string> keys{"time:generation"s, "time:total"s, "weight"s, "alphaEM"s, "alphaS"s};
+  };
+}  // namespace
+
+Event::EventMetadata::EventMetadata() {
+  values_.fill(0.);
+  (*this)[TIME_GENERATION] = -1.;
+  (*this)[TIME_TOTAL] = -1.;
+  (*this)[WEIGHT] = 1.;
+  (*this)[ALPHA_EM] = constants::ALPHA_EM;
+  (*this)[ALPHA_S] = constants::ALPHA_QCD;
+}
+
+size_t Event::EventMetadata::key(const std::string& key) {
+  auto& registry = MetadataRegistry::get();
+  {  // most lookups are performed on already registered keys, which only require a shared access
+    std::shared_lock<std::shared_mutex> lock(registry.mutex);
+    if (const auto slot = registry.find(key); slot < registry.keys.size())
+      return slot;
+  }
+  std::unique_lock<std::shared_mutex> lock(registry.mutex);
+  if (const auto slot = registry.find(key); slot < registry.keys.size())  // registered in the meantime
+    return slot;
+  if (registry.keys.size() >= MAX_KEYS)
+    throw CG_FATAL("Event:EventMetadata") << "Too many metadata keys registered (" << MAX_KEYS
+                                          << " allowed) while registering '" << key << "'.";
+  registry.keys.emplace_back(key);
+  return registry.keys.size() - 1;
+}
+
+std::string Event::EventMetadata::name(size_t key) {
+  auto& registry = MetadataRegistry::get();
+  std::shared_lock<std::shared_mutex> lock(registry.mutex);
+  if (key >= registry.keys.size())
+    throw CG_FATAL("Event:EventMetadata") << "Unregistered metadata key slot: " << key << ".";
+  return registry.keys.at(key);
+}
+
+bool Event::EventMetadata::operator==(const EventMetadata& oth) const {
+  if (set_ != oth.set_)
+    return false;
+  for (size_t i = 0; i < MAX_KEYS; ++i)
+    if (set_[i] && values_[i] != oth.values_[i])
+      return false;
+  return true;
+}
+
+float Event::EventMetadata::operator()(const std::string& key) const {
+  auto& registry = MetadataRegistry::get();
+  std::shared_lock<std::shared_mutex> lock(registry.mutex);
+  if (const auto slot = registry.find(key); slot < registry.keys.size())
+    return operator()(slot);
+  return -1.;
+}
+
+void Event::EventMetadata::clear() { set_.reset(); }
+
+std::unordered_map<std::string, float> Event::EventMetadata::entries() const {
+  std::unordered_map<std::string, float> out;
+  for (size_t i = 0; i < MAX_KEYS; ++i)
+    if (set_[i])
+      out[name(i)] = values_[i];
+  return out;
+}
+
+void Event::EventMetadata::invalidKey(size_t key) {
+  throw CG_FATAL("Event:EventMetadata") << "Invalid metadata key slot: " << key << ".";
+}
@@ -16,9 +16,11 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/Event/Particle.h"
 #include "CepGen/Physics/PDG.h"
 #include "CepGen/Utils/Collections.h"
@@ -199,14 +201,43 @@ namespace cepgen {
   }
 }  // namespace cepgen
 
-ParticlesMap::ParticlesMap(const ParticlesMap& other)
-    : std::unordered_map<Particle::Role, Particles, utils::EnumHash<Particle::Role> >() {
-  *this = other;
+ParticlesMap::ParticlesMap() {
+  for (const auto& role : {Particle::Role::IncomingBeam1,
+                           Particle::Role::IncomingBeam2,
+                           Particle::Role::Parton1,
+                           Particle::Role::Parton2,
+                           Particle::Role::Intermediate,
+                           Particle::Role::OutgoingBeam1,
+                           Particle::Role::OutgoingBeam2,
+                           Particle::Role::CentralSystem,
+                           Particle::Role::UnknownRole})
+    slots_[slot(role)].first = role;
+  registered_.fill(false);
 }
 
-ParticlesMap& ParticlesMap::operator=(const ParticlesMap& other) {
-  for (const auto& [role, particles] : other)
-    for (const auto& particle : particles)
-      (*this)[role].emplace_back(Particle(particle));
-  return *this;
+bool ParticlesMap::operator==(const ParticlesMap& oth) const {
+  if (registered_ != oth.registered_)
+    return false;
+  for (size_t i = 0; i < NUM_ROLES; ++i)
+    if (registered_[i] && slots_[i].second != oth.slots_[i].second)
+      return false;
+  return true;
+}
+
+bool ParticlesMap::empty() const {
+  return std::none_of(registered_.begin(), registered_.end(), [](bool registered) { return registered; });
+}
+
+void ParticlesMap::clear() {
+  for (auto& slot : slots_)
+    slot.second.clear();
+  registered_.fill(false);
+}
+
+void ParticlesMap::invalidRole(Particle::Role role) {
+  throw CG_FATAL("ParticlesMap") << "Invalid particle role: " << static_cast<int>(role) << ".";
+}
+
+void ParticlesMap::missingRole(Particle::Role role) {
+  throw CG_FATAL("ParticlesMap") << "Failed to retrieve a particle with " << role << " role.";
 }
@@ -0,0 +1,108 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/AsynchronousExporters.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Utils/RingBuffer.h"
+
+using namespace cepgen;
+
+/// Background writer feeding one output module
+struct AsynchronousExporters::Writer {
+  explicit Writer(EventExporter& exporter, size_t buffer_size)
+      : exporter(exporter), queue(buffer_size), thread([this] { run(); }) {}
+  ~Writer() {
+    stop = true;
+    thread.join();
+  }
+  /// Write all events from the queue, until requested to stop
+  void run() {
+    std::shared_ptr<const Event> event;
+    while (true) {
+      if (queue.pop(event)) {
+        if (!exception)  // once an output module has failed, further events are discarded
+          try {
+            if (!(exporter << *event))
+              failed = true;
+          } catch (...) {
+            exception = std::current_exception();
+            failed = true;
+          }
+        event.reset();
+        num_written.fetch_add(1, std::memory_order_release);
+      } else if (stop.load(std::memory_order_acquire) && queue.empty())
+        break;
+      else
+        std::this_thread::sleep_for(std::chrono::microseconds(50));  // idle writer
+    }
+  }
+
+  EventExporter& exporter;
+  utils::RingBuffer<std::shared_ptr<const Event> > queue;
+  size_t num_queued{0};                ///< Number of events queued (producer side)
+  std::atomic<size_t> num_written{0};  ///< Number of events processed by the writer thread
+  std::atomic<bool> failed{false};     ///< Has the output module failed to write an event?
+  std::atomic<bool> stop{false};       ///< Has the writer thread been requested to stop?
+  std::exception_ptr exception;        ///< Exception raised by the output module, if any (set before the failure flag)
+  std::thread thread;                  ///< Writer thread (started once all other members are built)
+};
+
+AsynchronousExporters::AsynchronousExporters(const std::vector<std::unique_ptr<EventExporter> >& exporters,
+                                             size_t buffer_size) {
+  if (buffer_size == 0)
+    throw CG_FATAL("AsynchronousExporters") << "Events buffer size must be strictly positive.";
+  for (const auto& exporter : exporters)
+    writers_.emplace_back(new Writer(*exporter, buffer_size));
+  CG_DEBUG("AsynchronousExporters") << "Started " << writers_.size() << " writer thread(s) with a buffer of "
+                                    << (writers_.empty() ? 0 : writers_.at(0)->queue.capacity()) << " event(s) each.";
+}
+
+AsynchronousExporters::~AsynchronousExporters() = default;  // all queued events are written before the threads join
+
+bool AsynchronousExporters::operator<<(const Event& event) {
+  for (const auto& writer : writers_)
+    if (writer->failed) {
+      if (writer->exception)  // propagate the output module exception to the generating thread
+        std::rethrow_exception(writer->exception);
+      return false;
+    }
+  const auto event_copy = std::make_shared<const Event>(event);  // shared among all writers
+  for (auto& writer : writers_) {
+    auto element = event_copy;
+    while (!writer->queue.push(element))  // back-pressure: wait for the writer thread to free a slot
+      std::this_thread::yield();
+    ++writer->num_queued;
+  }
+  return true;
+}
+
+void AsynchronousExporters::flush() {
+  for (const auto& writer : writers_)
+    while (writer->num_written.load(std::memory_order_acquire) < writer->num_queued)
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+  for (const auto& writer : writers_)
+    if (writer->exception)
+      std::rethrow_exception(writer->exception);
+}
@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 
 #include "CepGen/Core/Exception.h"
@@ -32,90 +33,145 @@ const std::regex EventBrowser::rgx_select_role_("([a-zA-Z0-9]+)\\(([a-z]+[0-9]?)
 const std::regex EventBrowser::rgx_select_role2_("([a-zA-Z0-9]+)\\(([a-z]+[0-9]?),([a-z]+[0-9]?)\\)",
                                                  std::regex_constants::extended);
 
-double EventBrowser::get(const Event& event, const std::string& variable_name) const {
+EventBrowser::Accessor EventBrowser::compile(const std::string& variable_name) const {
+  Accessor accessor;
+  accessor.name_ = variable_name;
   std::smatch sm;
-  if (std::regex_match(variable_name, sm, rgx_select_id_))  // particle-level variables (indexed by integer id)
-    return variable(event, event(std::stoul(sm[2].str())), sm[1].str());
-  if (std::regex_match(variable_name, sm, rgx_select_id2_))  // particle-level variables (indexed by integer id)
-    return variable(event, event(std::stoul(sm[2].str())), event(std::stoul(sm[3].str())), sm[1].str());
-  const auto check_role = [&](const std::string& role, const std::string& variable) -> bool {
+  const auto check_role = [&](const std::string& role) -> bool {
     if (role_str_.count(role) > 0)
       return true;
     CG_WARNING("EventBrowser") << "Invalid particle role retrieved from configuration: \"" << role << "\".\n\t"
-                               << "Skipping the variable \"" << variable << "\" in the output module.";
+                               << "Skipping the variable \"" << variable_name << "\" in the output module.";
     return false;
   };
-  if (std::regex_match(variable_name, sm, rgx_select_role_)) {  // particle-level variables (indexed by role)
-    if (const auto& str_role = sm[2].str(); check_role(str_role, variable_name))
-      return variable(event, event(role_str_.at(str_role))[0], sm[1].str());
-    return INVALID_OUTPUT;
-  }
-  if (std::regex_match(variable_name, sm, rgx_select_role2_)) {  // particle-level variables (indexed by role)
-    if (const auto &str_role1 = sm[2].str(), &str_role2 = sm[3].str();
-        check_role(str_role1, variable_name) && check_role(str_role2, variable_name))
-      return variable(event, event(role_str_.at(str_role1))[0], event(role_str_.at(str_role2))[0], sm[1].str());
-    return INVALID_OUTPUT;
-  }
-  return variable(event, variable_name);  // event-level variables
+  if (std::regex_match(variable_name, sm, rgx_select_id_) ||
+      std::regex_match(variable_name, sm, rgx_select_id2_)) {  // particle-level variables (indexed by integer id)
+    accessor.num_particles_ = sm.size() - 2;
+    for (size_t i = 0; i < accessor.num_particles_; ++i)
+      accessor.selectors_[i].id = std::stoi(sm[i + 2].str());
+    compileParticleVariable(accessor, sm[1].str());
+  } else if (std::regex_match(variable_name, sm, rgx_select_role_) ||
+             std::regex_match(variable_name, sm, rgx_select_role2_)) {  // particle-level variables (indexed by role)
+    accessor.num_particles_ = sm.size() - 2;
+    for (size_t i = 0; i < accessor.num_particles_; ++i) {
+      if (!check_role(sm[i + 2].str()))
+        return accessor;  // invalid accessor
+      accessor.selectors_[i].by_role = true;
+      accessor.selectors_[i].role = role_str_.at(sm[i + 2].str());
+    }
+    compileParticleVariable(accessor, sm[1].str());
+  } else
+    compileEventVariable(accessor, variable_name);  // event-level variables
+  return accessor;
 }
 
-double EventBrowser::variable(const Event& event, const Particle& particle, const std::string& variable_name) const {
-  if (m_mom_str_.count(variable_name)) {
-    const auto& meth = m_mom_str_.at(variable_name);
-    return (particle.momentum().*meth)();
-  }
-  if (variable_name == "xi") {
-    if (const auto& moth = particle.mothers(); !moth.empty())
-      return 1. - particle.momentum().energy() / event(*moth.begin()).momentum().energy();
-    CG_WARNING("EventBrowser") << "Failed to retrieve parent particle to compute xi "
-                               << "for the following particle:\n"
-                               << particle;
-    return INVALID_OUTPUT;
-  }
-  if (variable_name == "pdg")
-    return static_cast<double>(particle.integerPdgId());
-  if (variable_name == "charge")
-    return particle.charge();
-  if (variable_name == "status")
-    return static_cast<double>(particle.status());
-  throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << variable_name << "\".";
+double EventBrowser::get(const Event& event, const std::string& variable_name) const {
+  return compile(variable_name)(event);
 }
 
-double EventBrowser::variable(const Event&,
-                              const Particle& particle1,
-                              const Particle& particle2,
-                              const std::string& variable_name) const {
-  if (m_two_mom_str_.count(variable_name)) {
-    const auto& meth = m_two_mom_str_.at(variable_name);
-    return (particle1.momentum().*meth)(particle2.momentum());
+void EventBrowser::compileParticleVariable(Accessor& accessor, const std::string& variable_name) const {
+  using Quantity = Accessor::Quantity;
+  if (accessor.num_particles_ == 2) {
+    if (m_two_mom_str_.count(variable_name)) {
+      accessor.quantity_ = Quantity::twoMomenta;
+      accessor.two_momenta_method_ = m_two_mom_str_.at(variable_name);
+      return;
+    }
+    if (variable_name == "acop"s) {  // two-particle acoplanarity
+      accessor.quantity_ = Quantity::acoplanarity;
+      return;
+    }
+  }
+  if (m_mom_str_.count(variable_name)) {  // single-particle, or two-particles system momentum
+    accessor.quantity_ = Quantity::momentum;
+    accessor.momentum_method_ = m_mom_str_.at(variable_name);
+    return;
   }
-  if (m_mom_str_.count(variable_name)) {
-    const auto& meth = m_mom_str_.at(variable_name);
-    return ((particle1.momentum() + particle2.momentum()).*meth)();
+  if (accessor.num_particles_ == 1) {
+    if (variable_name == "xi")
+      accessor.quantity_ = Quantity::xi;
+    else if (variable_name == "pdg")
+      accessor.quantity_ = Quantity::pdg;
+    else if (variable_name == "charge")
+      accessor.quantity_ = Quantity::charge;
+    else if (variable_name == "status")
+      accessor.quantity_ = Quantity::status;
+    if (accessor.quantity_ != Quantity::invalid)
+      return;
   }
-  if (variable_name == "acop"s)  // two-particle acoplanarity
-    return 1. - fabs(particle1.momentum().deltaPhi(particle2.momentum()) * M_1_PI);
   throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << variable_name << "\".";
 }
 
-double EventBrowser::variable(const Event& event, const std::string& variable_name) {
+void EventBrowser::compileEventVariable(Accessor& accessor, const std::string& variable_name) {
+  using Quantity = Accessor::Quantity;
   if (variable_name == "np")  // number of particles in event (whatever the status)
-    return static_cast<double>(event.size());
-  if (variable_name == "nob1" ||
-      variable_name == "nob2") {  // number of (stable) particles in outgoing diffractive system
-    const auto& beam_particles =
-        event(variable_name == "nob1" ? Particle::Role::OutgoingBeam1 : Particle::Role::OutgoingBeam2);
-    return static_cast<double>(std::count_if(beam_particles.begin(), beam_particles.end(), [](const auto& particle) {
-      return static_cast<int>(particle.status()) > 0;
-    }));
+    accessor.quantity_ = Quantity::numParticles;
+  else if (variable_name == "nob1")  // number of (stable) particles in outgoing diffractive system
+    accessor.quantity_ = Quantity::numOutgoingBeam1;
+  else if (variable_name == "nob2")
+    accessor.quantity_ = Quantity::numOutgoingBeam2;
+  else if (variable_name == "met")  // missing transverse energy
+    accessor.quantity_ = Quantity::missingEt;
+  else if (variable_name == "mephi"s)  // azimuthal component of the missing transverse energy
+    accessor.quantity_ = Quantity::missingEtPhi;
+  else if (variable_name == "cmEnergy")  // two-beam centre-of-mass energy
+    accessor.quantity_ = Quantity::cmEnergy;
+  else if (startsWith(variable_name, "meta:")) {  // metadata field
+    accessor.quantity_ = Quantity::metadata;
+    accessor.metadata_key_ = Event::EventMetadata::key(variable_name.substr(5));
+  } else
+    throw CG_ERROR("EventBrowser") << "Failed to retrieve the event-level variable \"" << variable_name << "\".";
+}
+
+const cepgen::Particle& EventBrowser::Accessor::Selector::operator()(const Event& event) const {
+  return by_role ? event(role)[0] : event(id);
+}
+
+double EventBrowser::Accessor::operator()(const Event& event) const {
+  switch (quantity_) {
+    case Quantity::invalid:
+      return INVALID_OUTPUT;
+    case Quantity::momentum:
+      if (num_particles_ == 1)
+        return (selectors_[0](event).momentum().*momentum_method_)();
+      return ((selectors_[0](event).momentum() + selectors_[1](event).momentum()).*momentum_method_)();
+    case Quantity::twoMomenta:
+      return (selectors_[0](event).momentum().*two_momenta_method_)(selectors_[1](event).momentum());
+    case Quantity::acoplanarity:
+      return 1. - std::fabs(selectors_[0](event).momentum().deltaPhi(selectors_[1](event).momentum()) * M_1_PI);
+    case Quantity::xi: {
+      const auto& particle = selectors_[0](event);
+      if (const auto& moth = particle.mothers(); !moth.empty())
+        return 1. - particle.momentum().energy() / event(*moth.begin()).momentum().energy();
+      CG_WARNING("EventBrowser") << "Failed to retrieve parent particle to compute xi "
+                                 << "for the following particle:\n"
+                                 << particle;
+      return INVALID_OUTPUT;
+    }
+    case Quantity::pdg:
+      return static_cast<double>(selectors_[0](event).integerPdgId());
+    case Quantity::charge:
+      return selectors_[0](event).charge();
+    case Quantity::status:
+      return static_cast<double>(selectors_[0](event).status());
+    case Quantity::numParticles:
+      return static_cast<double>(event.size());
+    case Quantity::numOutgoingBeam1:
+    case Quantity::numOutgoingBeam2: {
+      const auto& beam_particles = event(quantity_ == Quantity::numOutgoingBeam1 ? Particle::Role::OutgoingBeam1
+                                                                                 : Particle::Role::OutgoingBeam2);
+      return static_cast<double>(std::count_if(beam_particles.begin(), beam_particles.end(), [](const auto& particle) {
+        return static_cast<int>(particle.status()) > 0;
+      }));
+    }
+    case Quantity::missingEt:
+      return event.missingMomentum().pt();
+    case Quantity::missingEtPhi:
+      return event.missingMomentum().phi();
+    case Quantity::cmEnergy:
+      return event.cmEnergy();
+    case Quantity::metadata:
+      return event.metadata(metadata_key_);
   }
-  if (variable_name == "met")  // missing transverse energy
-    return event.missingMomentum().pt();
-  if (variable_name == "mephi"s)  // azimuthal component of the missing transverse energy
-    return event.missingMomentum().phi();
-  if (variable_name == "cmEnergy")  // two-beam centre-of-mass energy
-    return event.cmEnergy();
-  if (startsWith(variable_name, "meta:"))  // metadata field
-    return event.metadata(variable_name.substr(5));
-  throw CG_ERROR("EventBrowser") << "Failed to retrieve the event-level variable \"" << variable_name << "\".";
+  return INVALID_OUTPUT;
 }
@@ -48,13 +48,13 @@ public:
         auto hist = utils::Hist1D(hvar.set("name", name));
         hist.xAxis().setLabel(vars.at(0));
         hist.yAxis().setLabel("d$\\sigma$/d" + vars.at(0) + " (pb/bin)");
-        hists1d_.emplace_back(Hist1DInfo{vars.at(0), hist, log});
+        hists1d_.emplace_back(Hist1DInfo{browser_.compile(vars.at(0)), hist, log});
       } else if (vars.size() == 2) {  // 2D histogram
         auto hist = utils::Hist2D(hvar.set("name", utils::sanitise(name)));
         hist.xAxis().setLabel(vars.at(0));
         hist.yAxis().setLabel(vars.at(1));
         hist.zAxis().setLabel("d${}^2\\sigma$/d" + vars.at(0) + "/d" + vars.at(1) + " (pb/bin)");
-        hists2d_.emplace_back(Hist2DInfo{vars.at(0), vars.at(1), hist, log});
+        hists2d_.emplace_back(Hist2DInfo{browser_.compile(vars.at(0)), browser_.compile(vars.at(1)), hist, log});
       } else
         throw CG_FATAL("EventHarvester") << "Invalid number of variables to correlate for '" << key << "'.";
     }
@@ -93,9 +93,9 @@ public:
   bool operator<<(const Event& event) override {
     // increment the corresponding histograms
     for (auto& info : hists1d_)
-      info.histogram.fill(browser_.get(event, info.variable));
+      info.histogram.fill(info.variable(event));
     for (auto& info : hists2d_)
-      info.histogram.fill(browser_.get(event, info.variable1), browser_.get(event, info.variable2));
+      info.histogram.fill(info.variable1(event), info.variable2(event));
     ++num_events_;
     return true;
   }
@@ -115,14 +115,14 @@ private:
   unsigned long num_events_{0ul};  ///< Number of events processed
   std::string proc_name_;          ///< Name of the physics process
   struct Hist1DInfo {
-    std::string variable;
+    utils::EventBrowser::Accessor variable;
     utils::Hist1D histogram;
     bool log_y;
   };  ///< 1D histogram definition
   std::vector<Hist1DInfo> hists1d_;  ///< List of 1D histograms
   struct Hist2DInfo {
-    std::string variable1;
-    std::string variable2;
+    utils::EventBrowser::Accessor variable1;
+    utils::EventBrowser::Accessor variable2;
     utils::Hist2D histogram;
     bool log_z;
   };  ///< 2D histogram definition
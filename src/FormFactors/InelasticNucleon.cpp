@@ -16,8 +16,10 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/FormFactors/Parameterisation.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Modules/FormFactorsFactory.h"
@@ -25,7 +27,11 @@
 #include "CepGen/Modules/StructureFunctionsFactory.h"
 #include "CepGen/Physics/Utils.h"
 #include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/GridHandler.h"
 #include "CepGen/Utils/Message.h"
+#include "CepGen/Utils/TabulationCache.h"
+
+using namespace std::string_literals;
 
 namespace cepgen::formfac {
   class InelasticNucleon : public Parameterisation {
@@ -37,20 +43,16 @@ namespace cepgen::formfac {
           compute_fm_(steer<bool>("computeFM")),
           mx_range_(steer<Limits>("mxRange")),
           mx2_range_{mx_range_.min() * mx_range_.min(), mx_range_.max() * mx_range_.max()},
-          dm2_range_{mx2_range_.min() - mp2_, mx2_range_.max() - mp2_},
-          eval_fe_([this](double mx2) {
-            const auto xbj = utils::xBj(q2_, mp2_, mx2);
-            return sf_->F2(xbj, q2_) * xbj;
-          }),
-          eval_fm_([this](double mx2) {
-            const auto xbj = utils::xBj(q2_, mp2_, mx2);
-            return sf_->F2(xbj, q2_) / xbj;
-          }) {
+          dm2_range_{mx2_range_.min() - mp2_, mx2_range_.max() - mp2_} {
       CG_INFO("InelasticNucleon") << "Inelastic nucleon form factors parameterisation built with:\n"
                                   << " * structure functions modelling: " << steer<ParametersList>("structureFunctions")
                                   << "\n"
                                   << " * integrator algorithm: " << steer<ParametersList>("integrator") << "\n"
                                   << " * diffractive mass range: " << steer<Limits>("mxRange") << " GeV^2.";
+      if (steer<bool>("tabulate")) {  // retrieve (or build) the table of integrals shared by all identical instances
+        const auto key = params_.serialise();
+        table_ = utils::SharedTabulations<const Table>::get(key, *this, key);
+      }
     }
 
     static ParametersDescription description() {
@@ -62,24 +64,134 @@ namespace cepgen::formfac {
           .setDescription("type of numerical integrator algorithm to use");
       desc.add("computeFM", false).setDescription("compute, or neglect the F2/xbj^3 term");
       desc.add("mxRange", Limits{1.0732 /* mp + mpi0 */, 20.}).setDescription("diffractive mass range (in GeV/c^2)");
+      desc.add("tabulate", true).setDescription("tabulate the mass-integrated structure functions in Q^2?");
+      desc.add("q2Range", Limits{1.e-10, 1.e5}).setDescription("Q^2 range to tabulate (in GeV^2)");
+      desc.add("numPoints", 100).setDescription("initial number of (log-uniform) tabulation points in Q^2");
+      desc.add("maxPoints", 10000).setDescription("maximal number of tabulation points after adaptive refinement");
+      desc.add("tolerance", 1.e-4).setDescription("relative interpolation accuracy targeted by the refinement");
+      desc.add("cacheDirectory", ""s)
+          .setDescription("if set, directory where tabulations are persisted for subsequent runs");
       return desc;
     }
 
   protected:
     void eval() override {
+      const auto integrals = table_ && table_->contains(q2_) ? table_->interpolate(q2_) : integrate(q2_);
       const auto inv_q2 = 1. / q2_;
-      const auto fe = integrator_->integrate(eval_fe_, mx2_range_) * inv_q2;
-      const auto fm = compute_fm_ ? integrator_->integrate(eval_fm_, mx2_range_) * inv_q2 : 0.;
-      setFEFM(fe, fm);
+      setFEFM(integrals[0] * inv_q2, integrals[1] * inv_q2);
     }
     bool fragmenting() const override { return true; }
 
   private:
+    using integrals_t = std::array<double, 2>;  ///< Mass-integrated (F2*xBj, F2/xBj) pair
+    /// Integrate the structure functions over the diffractive mass range for a given virtuality
+    integrals_t integrate(double q2) const {
+      const auto fe = integrator_->integrate(
+          [this, &q2](double mx2) {
+            const auto xbj = utils::xBj(q2, mp2_, mx2);
+            return sf_->F2(xbj, q2) * xbj;
+          },
+          mx2_range_);
+      const auto fm = compute_fm_ ? integrator_->integrate(
+                                        [this, &q2](double mx2) {
+                                          const auto xbj = utils::xBj(q2, mp2_, mx2);
+                                          return sf_->F2(xbj, q2) / xbj;
+                                        },
+                                        mx2_range_)
+                                  : 0.;
+      return {fe, fm};
+    }
+
+    /// Adaptive \f$\log Q^2\f$ tabulation of the mass-integrated structure functions
+    class Table {
+    public:
+      explicit Table(const InelasticNucleon& ff, const std::string& key) {
+        const utils::TabulationCache cache(ff.steer<std::string>("cacheDirectory"), "InelasticNucleon", key);
+        if (GridHandler<1, 2> grid(GridType::linear); cache.load(grid)) {  // retrieve a table from a previous run
+          for (const auto& [lq2, values] : grid.values()) {
+            lq2_.emplace_back(lq2.at(0));
+            values_.emplace_back(values);
+          }
+          if (lq2_.size() >= 2) {
+            CG_INFO("InelasticNucleon") << "Structure functions integrals retrieved from '" << cache.path() << "' for "
+                                        << lq2_.size() << " Q^2 values.";
+            return;
+          }
+          lq2_.clear();
+          values_.clear();
+        }
+        build(ff);
+        if (cache.enabled()) {  // store the table for subsequent runs
+          GridHandler<1, 2> grid(GridType::linear);
+          for (size_t i = 0; i < lq2_.size(); ++i)
+            grid.insert({lq2_.at(i)}, values_.at(i));
+          grid.initialise();
+          cache.save(grid);
+        }
+      }
+
+      /// Is the virtuality within the tabulated range?
+      inline bool contains(double q2) const {
+        const auto lq2 = std::log(q2);
+        return lq2 >= lq2_.front() && lq2 <= lq2_.back();
+      }
+      /// Linear interpolation of the tabulated integrals in \f$\log Q^2\f$
+      inline integrals_t interpolate(double q2) const {
+        const auto lq2 = std::log(q2);
+        const auto it = std::upper_bound(lq2_.begin(), lq2_.end(), lq2);
+        const size_t i = std::min<size_t>(std::max<long>(std::distance(lq2_.begin(), it) - 1, 0), lq2_.size() - 2);
+        const auto t = (lq2 - lq2_[i]) / (lq2_[i + 1] - lq2_[i]);
+        return {values_[i][0] + t * (values_[i + 1][0] - values_[i][0]),
+                values_[i][1] + t * (values_[i + 1][1] - values_[i][1])};
+      }
+
+    private:
+      /// Compute the integrals on a regular grid, and refine it until the interpolation accuracy is reached
+      void build(const InelasticNucleon& ff) {
+        const auto q2_range = ff.steer<Limits>("q2Range");
+        const auto num_points = std::max(ff.steer<int>("numPoints"), 2);
+        const auto max_points = static_cast<size_t>(ff.steer<int>("maxPoints"));
+        const auto tolerance = ff.steer<double>("tolerance");
+        if (!q2_range.valid() || q2_range.min() <= 0.)
+          throw CG_FATAL("InelasticNucleon") << "Invalid tabulation range: Q^2 in " << q2_range << ".";
+        const Limits lq2_range{std::log(q2_range.min()), std::log(q2_range.max())};
+        for (const auto& lq2 : lq2_range.generate(num_points)) {
+          lq2_.emplace_back(lq2);
+          values_.emplace_back(ff.integrate(std::exp(lq2)));
+        }
+        // bisect all intervals whose midpoint is not reproduced by the interpolation
+        auto accurate = [&tolerance](double exact, double interpolated) {
+          return std::fabs(interpolated - exact) <= tolerance * std::fabs(exact);
+        };
+        for (size_t i = 0; i + 1 < lq2_.size();) {
+          if (lq2_.size() >= max_points) {
+            CG_WARNING("InelasticNucleon") << "Maximal number of tabulation points (" << max_points
+                                           << ") reached before the required accuracy (" << tolerance << ").";
+            break;
+          }
+          const auto lq2 = 0.5 * (lq2_[i] + lq2_[i + 1]);
+          const auto exact = ff.integrate(std::exp(lq2));
+          if (accurate(exact[0], 0.5 * (values_[i][0] + values_[i + 1][0])) &&
+              accurate(exact[1], 0.5 * (values_[i][1] + values_[i + 1][1]))) {
+            ++i;
+            continue;
+          }
+          lq2_.insert(lq2_.begin() + i + 1, lq2);  // refine the first half of the interval at next iteration
+          values_.insert(values_.begin() + i + 1, exact);
+        }
+        CG_INFO("InelasticNucleon") << "Structure functions integrals tabulated on " << lq2_.size()
+                                    << " points for Q^2 in " << q2_range << " GeV^2.";
+      }
+
+      std::vector<double> lq2_;         ///< Tabulated \f$\log Q^2\f$ values
+      std::vector<integrals_t> values_;  ///< Tabulated integrals
+    };
+
     const std::unique_ptr<strfun::Parameterisation> sf_;
     const std::unique_ptr<Integrator> integrator_;
     const double compute_fm_;
     const Limits mx_range_, mx2_range_, dm2_range_;
-    const std::function<double(double)> eval_fe_, eval_fm_;
+    std::shared_ptr<const Table> table_;  ///< Tabulated integrals (possibly shared with other instances)
   };
 }  // namespace cepgen::formfac
 using cepgen::formfac::InelasticNucleon;
@@ -22,8 +22,9 @@
 using namespace cepgen;
 
 FunctionIntegrand::FunctionIntegrand(size_t num_dimensions,
-                                     const std::function<double(const std::vector<double>&)>& function)
-    : function_(function), num_dimensions_(num_dimensions) {}
+                                     const std::function<double(const std::vector<double>&)>& function,
+                                     bool reentrant)
+    : function_(function), num_dimensions_(num_dimensions), reentrant_(reentrant) {}
 
 double FunctionIntegrand::eval(const std::vector<double>& coordinates) {
   if (coordinates.size() != size())
@@ -34,3 +35,9 @@ double FunctionIntegrand::eval(const std::vector<double>& coordinates) {
       << "f value for dim-" << coordinates.size() << " point " << coordinates << ": " << weight << ".";
   return weight;
 }
+
+std::unique_ptr<Integrand> FunctionIntegrand::clone(size_t) const {
+  if (!reentrant_)  // a copy of the function would share its captured state; only allow a serial evaluation
+    return nullptr;
+  return std::make_unique<FunctionIntegrand>(num_dimensions_, function_, reentrant_);
+}
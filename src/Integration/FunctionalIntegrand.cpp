@@ -33,6 +33,9 @@ FunctionalIntegrand::FunctionalIntegrand(const std::string& expression,
                                   << variables << "): " << functional_->expression() << ".";
 }
 
+FunctionalIntegrand::FunctionalIntegrand(std::unique_ptr<utils::Functional> functional)
+    : functional_(std::move(functional)) {}
+
 double FunctionalIntegrand::eval(const std::vector<double>& coordinates) {
   if (!functional_)
     throw CG_FATAL("FunctionalIntegrand:eval") << "Functional object was not properly initialised!";
@@ -47,3 +50,11 @@ size_t FunctionalIntegrand::size() const {
     throw CG_FATAL("FunctionalIntegrand:eval") << "Functional object was not properly initialised!";
   return functional_->variables().size();
 }
+
+std::unique_ptr<Integrand> FunctionalIntegrand::clone(size_t) const {
+  if (!functional_)
+    throw CG_FATAL("FunctionalIntegrand:clone") << "Functional object was not properly initialised!";
+  // each clone holds its own functional evaluator, as most of them are not reentrant
+  return std::unique_ptr<Integrand>(
+      new FunctionalIntegrand(FunctionalFactory::get().build(functional_->parameters())));
+}
@@ -0,0 +1,234 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/EventModifier.h"
+#include "CepGen/Integration/GridCache.h"
+#include "CepGen/Integration/GridParameters.h"
+#include "CepGen/Integration/Integrator.h"
+#include "CepGen/Process/Process.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Functional.h"
+#include "CepGen/Utils/Hasher.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace cepgen;
+
+namespace {
+  constexpr char kMagic[8] = "CGGRID";  ///< File format identifier
+  constexpr uint32_t kVersion = 2;      ///< File format version
+
+  size_t hash(const std::string& str) { return utils::Hasher<std::string, false>()(str); }
+
+  /// Human-readable (and seed-independent) summary of all the run parameters affecting the integrand
+  std::string configuration(const RunParameters& params) {
+    std::ostringstream os;
+    auto integrator_params = params.integrator();
+    integrator_params.erase("seed");
+    integrator_params.erase("randomGenerator");
+    os << params.process().parameters().serialise() << "|" << params.process().kinematics().parameters().serialise()
+       << "|" << integrator_params.serialise();
+    for (const auto& modifier : params.eventModifiersSequence()) {
+      auto modifier_params = modifier->parameters();
+      modifier_params.erase("seed");
+      os << "|modifier:" << modifier_params.serialise();
+    }
+    for (const auto& taming_function : params.tamingFunctions())
+      os << "|taming:" << taming_function->variables().at(0) << ":" << taming_function->expression();
+    return os.str();
+  }
+
+  template <typename T>
+  void write(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+  template <typename T>
+  void write(std::ostream& os, const std::vector<T>& values) {
+    write<uint64_t>(os, values.size());
+    os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+  }
+  void write(std::ostream& os, const std::string& str) { write(os, std::vector<char>(str.begin(), str.end())); }
+
+  template <typename T>
+  bool read(std::istream& is, T& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+  }
+  template <typename T>
+  bool read(std::istream& is, std::vector<T>& values) {
+    if (uint64_t size; read(is, size)) {
+      values.resize(size);
+      return static_cast<bool>(is.read(reinterpret_cast<char*>(values.data()), size * sizeof(T)));
+    }
+    return false;
+  }
+  bool read(std::istream& is, std::string& str) {
+    if (std::vector<char> buffer; read(is, buffer)) {
+      str = std::string(buffer.begin(), buffer.end());
+      return true;
+    }
+    return false;
+  }
+
+  /// Open a cache file and check its header consistency
+  /// \note The full configuration is compared, as two configurations may share a same hash
+  bool open(std::ifstream& file, const std::string& filename, const std::string& configuration) {
+    file.open(filename, std::ios::binary);
+    if (!file.is_open())
+      return false;
+    char magic[sizeof(kMagic)];
+    uint32_t version;
+    uint64_t file_key;
+    std::string file_configuration;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !read(file, version) || version != kVersion || !read(file, file_key) || file_key != hash(configuration) ||
+        !read(file, file_configuration) || file_configuration != configuration) {
+      CG_WARNING("GridCache:open") << "Invalid or incompatible grid cache file '" << filename << "'.";
+      return false;
+    }
+    return true;
+  }
+
+  /// Write a cache file and publish it atomically, as it may be concurrently read by other jobs
+  void publish(const std::string& filename,
+               const std::string& configuration,
+               const std::function<void(std::ostream&)>& writer) {
+    std::error_code err;
+    fs::create_directories(fs::path(filename).parent_path(), err);
+    const auto tmp_filename = filename + ".tmp" + std::to_string(std::random_device()());
+    {
+      std::ofstream file(tmp_filename, std::ios::binary);
+      file.write(kMagic, sizeof(kMagic));
+      write(file, kVersion);
+      write<uint64_t>(file, hash(configuration));
+      write(file, configuration);
+      writer(file);
+      if (!file.good()) {
+        CG_WARNING("GridCache:publish") << "Failed to write the grid cache file '" << tmp_filename << "'.";
+        fs::remove(tmp_filename, err);
+        return;
+      }
+    }
+    if (fs::rename(tmp_filename, filename, err); err) {
+      CG_WARNING("GridCache:publish") << "Failed to publish the grid cache file '" << filename
+                                      << "': " << err.message() << ".";
+      fs::remove(tmp_filename, err);
+      return;
+    }
+    CG_DEBUG("GridCache:publish") << "Grid cache file '" << filename << "' published.";
+  }
+}  // namespace
+
+GridCache::GridCache(const RunParameters& params)
+    : directory_(params.generation().gridCache()),
+      num_points_(params.generation().numPoints()),
+      configuration_(configuration(params)),
+      key_(hash(configuration_)) {
+  if (directory_.empty())
+    throw CG_FATAL("GridCache") << "No grid cache directory specified in the generation parameters.";
+  CG_DEBUG("GridCache") << "Grid cache handler built for configuration hash " << std::hex << key_ << std::dec
+                        << " in directory '" << directory_ << "'.";
+}
+
+bool GridCache::enabled(const RunParameters& params) { return !params.generation().gridCache().empty(); }
+
+bool GridCache::loadIntegration(Integrator& integrator, Value& cross_section) const {
+  const auto filename = path(key_, "integration");
+  std::ifstream file;
+  if (!open(file, filename, configuration_))
+    return false;
+  std::string integrator_name;
+  double value, uncertainty;
+  std::vector<double> state;
+  if (!read(file, integrator_name) || !read(file, value) || !read(file, uncertainty) || !read(file, state)) {
+    CG_WARNING("GridCache:loadIntegration") << "Corrupted grid cache file '" << filename << "'.";
+    return false;
+  }
+  if (integrator_name != integrator.name() || (!state.empty() && !integrator.restoreGridState(state))) {
+    CG_WARNING("GridCache:loadIntegration") << "Grid cache file '" << filename << "' is incompatible with the "
+                                            << integrator.name() << " integrator.";
+    return false;
+  }
+  cross_section = Value{value, uncertainty};
+  CG_INFO("GridCache:loadIntegration") << "Cross-section and integration grid retrieved from '" << filename << "'.";
+  return true;
+}
+
+void GridCache::saveIntegration(const Integrator& integrator, const Value& cross_section) const {
+  publish(path(key_, "integration"), configuration_, [&integrator, &cross_section](std::ostream& os) {
+    write(os, integrator.name());
+    write<double>(os, cross_section);
+    write<double>(os, cross_section.uncertainty());
+    write(os, integrator.gridState());
+  });
+}
+
+bool GridCache::loadGeneration(const Integrator& integrator,
+                               const ParametersList& worker_parameters,
+                               GridParameters& grid) const {
+  const auto configuration = generationConfiguration(integrator, worker_parameters);
+  const auto filename = path(hash(configuration), "generation");
+  std::ifstream file;
+  if (!open(file, filename, configuration))
+    return false;
+  std::vector<float> maxima;
+  if (!read(file, maxima) || maxima.size() != grid.size()) {
+    CG_WARNING("GridCache:loadGeneration") << "Corrupted or incompatible grid cache file '" << filename << "'.";
+    return false;
+  }
+  for (size_t i = 0; i < maxima.size(); ++i)
+    grid.setValue(i, maxima.at(i));
+  grid.setPrepared(true);
+  CG_INFO("GridCache:loadGeneration") << "Unweighting grid maxima retrieved from '" << filename << "'.";
+  return true;
+}
+
+void GridCache::saveGeneration(const Integrator& integrator,
+                               const ParametersList& worker_parameters,
+                               const GridParameters& grid) const {
+  const auto configuration = generationConfiguration(integrator, worker_parameters);
+  publish(path(hash(configuration), "generation"), configuration, [&grid](std::ostream& os) {
+    std::vector<float> maxima(grid.size());
+    for (size_t i = 0; i < grid.size(); ++i)
+      maxima[i] = grid.maxValue(i);
+    write(os, maxima);
+  });
+}
+
+std::string GridCache::generationConfiguration(const Integrator& integrator,
+                                               const ParametersList& worker_parameters) const {
+  // unweighting grid maxima depend on the integrator grid used for the phase space treatment
+  auto worker_params = worker_parameters;
+  worker_params.erase("randomGenerator");
+  const auto integrator_state = integrator.gridState();
+  return configuration_ + "|" + worker_params.serialise() + "|" + std::to_string(num_points_) + "|" +
+         std::string(reinterpret_cast<const char*>(integrator_state.data()), integrator_state.size() * sizeof(double));
+}
+
+std::string GridCache::path(size_t key, const std::string& type) const {
+  std::ostringstream os;
+  os << std::hex << key << "." << type << ".cgrid";
+  return (fs::path(directory_) / os.str()).string();
+}
@@ -0,0 +1,32 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2013-2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "CepGen/Integration/Integrand.h"
+
+using namespace cepgen;
+
+void Integrand::evalBatch(size_t num_points, const double* coordinates, double* weights) {
+  const auto num_dimensions = size();
+  std::vector<double> point(num_dimensions);
+  for (size_t i = 0; i < num_points; ++i) {
+    std::copy(coordinates + i * num_dimensions, coordinates + (i + 1) * num_dimensions, point.begin());
+    weights[i] = eval(point);
+  }
+}
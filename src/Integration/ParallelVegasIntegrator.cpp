@@ -0,0 +1,365 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <thread>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/Integrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/String.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+/// Multi-threaded implementation of the Vegas importance sampling algorithm \cite Lepage:1977sw
+/// \note The function calls of each iteration are shared among several threads, each evaluating its own clone of the
+///  integrand. Per-bin accumulators are merged into a single grid before it is refined.
+class ParallelVegasIntegrator final : public Integrator {
+public:
+  explicit ParallelVegasIntegrator(const ParametersList& params)
+      : Integrator(params),
+        num_function_calls_(steer<int>("numFunctionCalls")),
+        num_warmup_calls_(steer<int>("numWarmupCalls")),
+        chi_square_cut_(steer<double>("chiSqCut")),
+        treat_(steer<bool>("treat")),
+        num_iterations_(steer<int>("iterations")),
+        num_bins_(steer<int>("bins")),
+        batch_size_(std::max(steer<int>("batchSize"), 1)),
+        alpha_(steer<double>("alpha")),
+        num_threads_(steer<int>("numThreads") > 0 ? steer<int>("numThreads")
+                                                  : std::max(std::thread::hardware_concurrency(), 1u)) {
+    if (num_bins_ < 2)
+      throw CG_FATAL("ParallelVegasIntegrator") << "Invalid number of bins per dimension: " << num_bins_ << ".";
+    if (num_iterations_ < 1)
+      throw CG_FATAL("ParallelVegasIntegrator") << "Invalid number of iterations per call: " << num_iterations_ << ".";
+  }
+
+  static ParametersDescription description() {
+    auto desc = Integrator::description();
+    desc.setDescription("Multi-threaded Vegas importance sampling integrator");
+    desc.add("numFunctionCalls", 100'000).setDescription("number of function calls per phase space point evaluation");
+    desc.add("numWarmupCalls", 25'000).setDescription("number of function calls for the grid warm-up");
+    desc.add("chiSqCut", 1.5).setDescription("maximum (normalised) chi^2 to reach before stopping iterations");
+    desc.add("treat", true).setDescription("phase space treatment");
+    desc.add("iterations", 10).setDescription("number of iterations to perform for each call to the routine");
+    desc.add("alpha", 1.25).setDescription("stiffness of the rebinning algorithm");
+    desc.add("bins", 50).setDescription("number of bins per dimension in the importance sampling grid");
+    desc.add("batchSize", 128).setDescription("number of points handed over to the integrand in one single call");
+    desc.add("numThreads", 0).setDescription("number of threads sharing the function calls (0 = all available cores)");
+    desc.add("randomGenerator",
+             RandomGeneratorFactory::get().describeParameters("stl", ParametersList().set("type", "mt19937_64"s)))
+        .setDescription("type of random number generator to use for integration (one per thread)");
+    return desc;
+  }
+
+  Value run(Integrand& integrand, const std::vector<Limits>& range) override {
+    if (num_dimensions_ = integrand.size(); num_dimensions_ == 0)
+      throw CG_FATAL("ParallelVegasIntegrator:run") << "Invalid phase space dimension: " << num_dimensions_ << ".";
+    if (range.size() < num_dimensions_)
+      throw CG_FATAL("ParallelVegasIntegrator:run")
+          << "Insufficient number of limits (" << range << ") provided for dim-" << num_dimensions_ << " integrand.";
+    x_low_.resize(num_dimensions_);
+    x_range_.resize(num_dimensions_);
+    volume_ = 1.;
+    for (size_t j = 0; j < num_dimensions_; ++j) {
+      x_low_[j] = range.at(j).min(), x_range_[j] = range.at(j).range();
+      volume_ *= x_range_[j];
+    }
+    grid_.resize((num_bins_ + 1) * num_dimensions_);  // start from a uniform grid
+    for (size_t i = 0; i <= num_bins_; ++i)
+      for (size_t j = 0; j < num_dimensions_; ++j)
+        coord(i, j) = i * 1. / num_bins_;
+    prepareWorkers(integrand);
+
+    // launch integration
+    double chi_square = 0.;
+    iterate(num_warmup_calls_, 1, chi_square);  // warmup (prepare the grid)
+    CG_INFO("ParallelVegasIntegrator:warmup") << "Finished the Vegas warm-up.";
+
+    // integration phase
+    unsigned short num_calls = 0;
+    Value result;
+    do {
+      result = iterate(0.2 * num_function_calls_, num_iterations_, chi_square);
+      CG_LOG << "\t>> at call " << (++num_calls) << ": "
+             << utils::format(
+                    "average = %10.6f   "
+                    "sigma = %10.6f   chi2 = %4.3f.",
+                    static_cast<double>(result),
+                    result.uncertainty(),
+                    chi_square);
+    } while (std::fabs(chi_square - 1.) > chi_square_cut_ - 1.);
+    CG_DEBUG("ParallelVegasIntegrator:run")
+        << "Vegas grid information:\n\t"
+        << "ran for " << num_dimensions_ << " dimensions on " << utils::s("thread", workers_.size(), true) << ", "
+        << "and generated " << num_bins_ << " bins per dimension.\n\t"
+        << "Integration volume: " << volume_ << ".";
+    workers_.clear();  // release the integrand clones
+    return result;
+  }
+
+  double eval(Integrand& integrand, const std::vector<double>& coordinates) const override {
+    if (!treat_)  // by default, no grid treatment
+      return integrand.eval(coordinates);
+    // treatment of the integration grid
+    if (grid_.empty())
+      throw CG_FATAL("ParallelVegasIntegrator:eval") << "Vegas grid was not prepared prior to the grid treatment!";
+    // one coordinates buffer per thread, as this method may be called concurrently by several generator workers
+    thread_local std::vector<double> treated_coordinates;
+    treated_coordinates.resize(integrand.size());
+    double weight = 1.;
+    for (size_t j = 0; j < integrand.size(); ++j) {
+      const double z = coordinates.at(j) * num_bins_;
+      const auto id = std::min(static_cast<size_t>(z), num_bins_ - 1);  // coordinate of point before
+      const double bin_width = coord(id + 1, j) - coord(id, j);
+      // build new coordinate from linear interpolation
+      treated_coordinates[j] = coord(id, j) + (z - id) * bin_width;
+      weight *= bin_width * num_bins_;
+    }
+    return weight * integrand.eval(treated_coordinates);
+  }
+
+  std::vector<double> gridState() const override {
+    if (grid_.empty())
+      return {};
+    std::vector<double> state{static_cast<double>(num_bins_), static_cast<double>(num_dimensions_)};
+    state.insert(state.end(), grid_.begin(), grid_.end());
+    return state;
+  }
+
+  bool restoreGridState(const std::vector<double>& state) override {
+    if (state.size() < 2 || static_cast<size_t>(state.at(0)) != num_bins_)
+      return false;
+    const auto num_dimensions = static_cast<size_t>(state.at(1));
+    if (num_dimensions == 0 || state.size() != 2 + (num_bins_ + 1) * num_dimensions)
+      return false;
+    num_dimensions_ = num_dimensions;
+    grid_.assign(state.begin() + 2, state.end());
+    return true;
+  }
+
+private:
+  /// Thread-local integration objects and accumulators
+  struct Worker {
+    Integrand* integrand{nullptr};                     ///< Integrand evaluated by this thread
+    std::unique_ptr<Integrand> integrand_clone;        ///< Thread-owned integrand clone (if any)
+    std::unique_ptr<utils::RandomGenerator> random;    ///< Thread-local random number generator
+    std::vector<double> coordinates, jacobians, values;  ///< Coordinates, weights, and values of the points batch
+    std::vector<size_t> bins;                            ///< Bins indices of the points batch
+    std::vector<double> bins_sum_square;                 ///< Per-bin sum of f^2 values over this iteration
+    double sum{0.}, sum_square{0.};                      ///< Sum of f and f^2 values over this iteration
+  };
+
+  void prepareWorkers(Integrand& integrand) {
+    workers_.clear();
+    auto rng_params = steer<ParametersList>("randomGenerator");
+    const auto seed = rng_params.get<unsigned long long>("seed");
+    for (size_t i = 0; i < num_threads_; ++i) {
+      Worker worker;
+      if (i == 0)  // first thread is evaluating the user-provided integrand
+        worker.integrand = &integrand;
+      else if (worker.integrand_clone = integrand.clone(i); worker.integrand_clone)
+        worker.integrand = worker.integrand_clone.get();
+      else {
+        CG_WARNING("ParallelVegasIntegrator:prepare") << "Integrand cannot be cloned, integration will be serial.";
+        break;
+      }
+      // decorrelate the random number streams
+      worker.random = RandomGeneratorFactory::get().build(rng_params.set<unsigned long long>("seed", seed + i));
+      worker.coordinates.resize(batch_size_ * num_dimensions_);
+      worker.bins.resize(batch_size_ * num_dimensions_);
+      worker.jacobians.resize(batch_size_);
+      worker.values.resize(batch_size_);
+      worker.bins_sum_square.resize(num_bins_ * num_dimensions_);
+      workers_.emplace_back(std::move(worker));
+    }
+    CG_DEBUG("ParallelVegasIntegrator:prepare")
+        << "Prepared " << utils::s("integration thread", workers_.size(), true) << ".";
+  }
+
+  /// Perform a series of integration iterations, refining the grid after each of them
+  /// \param[in] num_calls Number of function calls for each iteration
+  /// \param[in] num_iterations Number of iterations to perform
+  /// \param[out] chi_square Normalised chi^2 of the weighted average over all iterations
+  /// \return Weighted average of all iterations results
+  Value iterate(size_t num_calls, size_t num_iterations, double& chi_square) {
+    if (num_calls < 2)
+      throw CG_FATAL("ParallelVegasIntegrator:iterate") << "Invalid number of function calls: " << num_calls << ".";
+    double weighted_sum = 0., sum_weights = 0., chi_square_sum = 0., last_mean = 0.;
+    size_t num_weighted_iterations = 0;
+    for (size_t it = 0; it < num_iterations; ++it) {
+      sample(num_calls);
+      // merge all threads accumulators
+      double sum = 0., sum_square = 0.;
+      bins_sum_square_.assign(num_bins_ * num_dimensions_, 0.);
+      for (const auto& worker : workers_) {
+        sum += worker.sum, sum_square += worker.sum_square;
+        for (size_t i = 0; i < bins_sum_square_.size(); ++i)
+          bins_sum_square_[i] += worker.bins_sum_square[i];
+      }
+      last_mean = sum / num_calls;
+      if (const auto variance = (sum_square / num_calls - last_mean * last_mean) / (num_calls - 1.); variance > 0.) {
+        const auto weight = 1. / variance;
+        weighted_sum += last_mean * weight;
+        sum_weights += weight;
+        chi_square_sum += last_mean * last_mean * weight;
+        ++num_weighted_iterations;
+      }
+      refineGrid();
+    }
+    if (sum_weights <= 0.) {  // e.g. constant integrand, no variance to weight the iterations with
+      chi_square = 0.;
+      return Value{last_mean, 0.};
+    }
+    const auto mean = weighted_sum / sum_weights;
+    chi_square = num_weighted_iterations > 1
+                     ? (chi_square_sum - weighted_sum * mean) / (num_weighted_iterations - 1.)
+                     : 0.;
+    return Value{mean, std::sqrt(1. / sum_weights)};
+  }
+
+  /// Share a given number of function calls among all threads
+  void sample(size_t num_calls) {
+    const auto num_workers = workers_.size();
+    if (num_workers == 1) {
+      sample(workers_.at(0), num_calls);
+      return;
+    }
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(num_workers);
+    for (size_t i = 0; i < num_workers; ++i)
+      threads.emplace_back([this, &exceptions, i, num_calls, num_workers] {
+        try {
+          sample(workers_.at(i), num_calls / num_workers + (i < num_calls % num_workers ? 1 : 0));
+        } catch (...) {
+          exceptions.at(i) = std::current_exception();
+        }
+      });
+    for (auto& thread : threads)
+      thread.join();
+    for (const auto& exception : exceptions)
+      if (exception)
+        std::rethrow_exception(exception);
+  }
+
+  /// Probe the integrand at several points distributed according to the current grid
+  /// \note Points are evaluated by batches to amortise the per-call overhead of the integrand
+  void sample(Worker& worker, size_t num_calls) const {
+    worker.sum = worker.sum_square = 0.;
+    std::fill(worker.bins_sum_square.begin(), worker.bins_sum_square.end(), 0.);
+    for (size_t first = 0; first < num_calls; first += batch_size_) {
+      const auto num_points = std::min(batch_size_, num_calls - first);
+      for (size_t n = 0; n < num_points; ++n) {  // build the batch of points
+        auto* coordinates = &worker.coordinates[n * num_dimensions_];
+        auto* bins = &worker.bins[n * num_dimensions_];
+        auto& weight = worker.jacobians[n] = volume_;
+        for (size_t j = 0; j < num_dimensions_; ++j) {
+          const double z = worker.random->uniform() * num_bins_;
+          const auto id = bins[j] = std::min(static_cast<size_t>(z), num_bins_ - 1);
+          const double bin_width = coord(id + 1, j) - coord(id, j);
+          coordinates[j] = x_low_[j] + (coord(id, j) + (z - id) * bin_width) * x_range_[j];
+          weight *= bin_width * num_bins_;
+        }
+      }
+      worker.integrand->evalBatch(num_points, worker.coordinates.data(), worker.values.data());
+      for (size_t n = 0; n < num_points; ++n) {  // accumulate the batch values
+        const auto value = worker.jacobians[n] * worker.values[n], value_square = value * value;
+        worker.sum += value;
+        worker.sum_square += value_square;
+        for (size_t j = 0; j < num_dimensions_; ++j)
+          worker.bins_sum_square[worker.bins[n * num_dimensions_ + j] * num_dimensions_ + j] += value_square;
+      }
+    }
+  }
+
+  /// Adapt the bins boundaries to the merged per-bin accumulators (smoothed and compressed with alpha)
+  void refineGrid() {
+    std::vector<double> bins_weights(num_bins_), new_coordinates(num_bins_ + 1);
+    for (size_t j = 0; j < num_dimensions_; ++j) {
+      const auto bin_sum_square = [this, &j](size_t i) -> double& { return bins_sum_square_[i * num_dimensions_ + j]; };
+      // smooth the accumulated values with their neighbours
+      double old_value = bin_sum_square(0), new_value = bin_sum_square(1), total = 0.;
+      bin_sum_square(0) = 0.5 * (old_value + new_value);
+      total += bin_sum_square(0);
+      for (size_t i = 1; i < num_bins_ - 1; ++i) {
+        const auto sum = old_value + new_value;
+        old_value = new_value;
+        new_value = bin_sum_square(i + 1);
+        bin_sum_square(i) = (sum + new_value) / 3.;
+        total += bin_sum_square(i);
+      }
+      bin_sum_square(num_bins_ - 1) = 0.5 * (new_value + old_value);
+      total += bin_sum_square(num_bins_ - 1);
+      if (total <= 0.)  // integrand vanishing along this dimension, nothing to adapt to
+        continue;
+      // compute the bins weights
+      double total_weight = 0.;
+      for (size_t i = 0; i < num_bins_; ++i) {
+        bins_weights[i] = 0.;
+        if (const auto value = bin_sum_square(i); value > 0.) {
+          const auto ratio = total / value;
+          bins_weights[i] = ratio > 1. ? std::pow((ratio - 1.) / ratio / std::log(ratio), alpha_) : 1.;
+        }
+        total_weight += bins_weights[i];
+      }
+      // redistribute the bins boundaries to share the weight evenly
+      const auto weight_per_bin = total_weight / num_bins_;
+      double x_old = 0., x_new = 0., cumulated_weight = 0.;
+      size_t i = 1;
+      for (size_t k = 0; k < num_bins_; ++k) {
+        cumulated_weight += bins_weights[k];
+        x_old = x_new;
+        x_new = coord(k + 1, j);
+        for (; cumulated_weight > weight_per_bin && i < num_bins_; ++i) {
+          cumulated_weight -= weight_per_bin;
+          new_coordinates[i] = x_new - (x_new - x_old) * cumulated_weight / bins_weights[k];
+        }
+      }
+      for (size_t k = 1; k < num_bins_; ++k)
+        coord(k, j) = new_coordinates[k];
+      coord(num_bins_, j) = 1.;
+    }
+  }
+
+  double& coord(size_t i, size_t j) { return grid_[i * num_dimensions_ + j]; }
+  double coord(size_t i, size_t j) const { return grid_[i * num_dimensions_ + j]; }
+
+  const int num_function_calls_;
+  const int num_warmup_calls_;
+  const double chi_square_cut_;
+  const bool treat_;  ///< Is the integrand to be smoothed for events generation?
+  const size_t num_iterations_;
+  const size_t num_bins_;
+  const size_t batch_size_;
+  const double alpha_;
+  const size_t num_threads_;
+
+  size_t num_dimensions_{0};
+  std::vector<double> x_low_, x_range_;  ///< Integration range
+  double volume_{1.};                    ///< Integration volume
+  std::vector<double> grid_;             ///< Normalised bins boundaries, for all dimensions
+  std::vector<double> bins_sum_square_;  ///< Per-bin sum of f^2 values, merged over all threads
+  std::vector<Worker> workers_;          ///< Thread-local integration objects
+};
+REGISTER_INTEGRATOR("ParallelVegas", ParallelVegasIntegrator);
@@ -16,7 +16,9 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <numeric>
+#include <random>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/RunParameters.h"
@@ -24,15 +26,21 @@
 #include "CepGen/EventFilter/EventBrowser.h"
 #include "CepGen/EventFilter/EventModifier.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/EventModifierFactory.h"
+#include "CepGen/Modules/FunctionalFactory.h"
+#include "CepGen/Physics/CompiledCuts.h"
 #include "CepGen/Process/Process.h"
 #include "CepGen/Utils/Functional.h"
 #include "CepGen/Utils/Math.h"
+#include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
 using namespace cepgen;
 
-ProcessIntegrand::ProcessIntegrand(const proc::Process& process)
-    : run_parameters_(new RunParameters), timer_(new utils::Timer) {
+ProcessIntegrand::ProcessIntegrand(const proc::Process& process) : ProcessIntegrand(process, new RunParameters) {}
+
+ProcessIntegrand::ProcessIntegrand(const proc::Process& process, const RunParameters* run_parameters)
+    : run_parameters_(run_parameters), timer_(new utils::Timer) {
   setProcess(process);
 }
 
@@ -45,6 +53,8 @@ ProcessIntegrand::ProcessIntegrand(const RunParameters* run_parameters)
   setProcess(run_parameters_->process());
 }
 
+ProcessIntegrand::~ProcessIntegrand() = default;
+
 size_t ProcessIntegrand::size() const { return process().ndim(); }
 
 void ProcessIntegrand::setProcess(const proc::Process& original_process) {
@@ -69,6 +79,14 @@ void ProcessIntegrand::setProcess(const proc::Process& original_process) {
     process().dumpVariables(&log.stream());
   });
   process().initialise();
+  cuts_ = std::make_unique<cuts::Compiled>(process().kinematics());  // only keep the active restrictions
+  // functional evaluators are not reentrant; each integrand (e.g. in multi-threaded runs) owns its taming functions
+  taming_functions_.clear();
+  taming_variables_.clear();
+  for (const auto& taming_function : run_parameters_->tamingFunctions()) {
+    taming_functions_.emplace_back(FunctionalFactory::get().build(taming_function->parameters()));
+    taming_variables_.emplace_back(bws_.compile(taming_function->variables().at(0)));
+  }
 
   CG_DEBUG("ProcessIntegrand:setProcess")
       << "Process integrand defined for dimension-" << size() << " process '" << process().name() << "'.";
@@ -86,9 +104,66 @@ const proc::Process& ProcessIntegrand::process() const {
   return *process_;
 }
 
+void ProcessIntegrand::setEventModifiersSequence(EventModifiersSequence&& modifiers) {
+  local_modifiers_ = std::move(modifiers);
+  CG_DEBUG("ProcessIntegrand:setEventModifiersSequence")
+      << "Integrand now owns " << utils::s("event modification algorithm", local_modifiers_.size(), true) << ".";
+}
+
+EventModifiersSequence ProcessIntegrand::cloneEventModifiers(size_t seed_offset) const {
+  EventModifiersSequence modifiers;
+  for (const auto& modifier : eventModifiers()) {
+    auto modifier_params = modifier->parameters();
+    if (const auto seed = modifier_params.get<int>("seed"); seed >= 0)  // user-defined seed, shifted for each copy
+      modifier_params.set<int>("seed", seed + static_cast<int>(seed_offset));
+    else  // time-based seed, resolved here for the copies to be decorrelated within one run, and between runs
+      modifier_params.set<int>("seed", static_cast<int>(std::random_device{}() >> 1));
+    modifiers.emplace_back(EventModifierFactory::get().build(modifier_params))->initialise(*run_parameters_);
+  }
+  return modifiers;
+}
+
+std::unique_ptr<Integrand> ProcessIntegrand::clone(size_t seed_offset) const {
+  // the clone shares the runtime parameters, but owns its process and event modification algorithms instances
+  auto integrand = std::unique_ptr<ProcessIntegrand>(new ProcessIntegrand(*process_, run_parameters_));
+  integrand->setStorage(storage_);
+  if (!eventModifiers().empty())
+    integrand->setEventModifiersSequence(cloneEventModifiers(seed_offset));
+  return integrand;
+}
+
+const EventModifiersSequence& ProcessIntegrand::eventModifiers() const {
+  if (!local_modifiers_.empty())
+    return local_modifiers_;
+  return run_parameters_->eventModifiersSequence();
+}
+
 double ProcessIntegrand::eval(const std::vector<double>& x) {
   CG_TICKER(const_cast<RunParameters*>(run_parameters_)->timeKeeper());
-  timer_->reset();  // start the timer
+  return computeWeight(x);
+}
+
+void ProcessIntegrand::evalBatch(size_t num_points, const double* coordinates, double* weights) {
+  CG_TICKER(const_cast<RunParameters*>(run_parameters_)->timeKeeper());  // one single monitoring for the whole batch
+  if (!process_->hasEvent() ||
+      (!storage_ && taming_functions_.empty() && eventModifiers().empty() && cuts_->empty())) {
+    process().weightBatch(num_points, coordinates, weights);  // weighted fast path, evaluated by the process itself
+    for (size_t i = 0; i < num_points; ++i)
+      if (!utils::positive(weights[i]))  // invalidate any unphysical behaviour
+        weights[i] = 0.;
+    return;
+  }
+  const auto num_dimensions = size();
+  coordinates_.resize(num_dimensions);
+  for (size_t i = 0; i < num_points; ++i) {
+    std::copy(coordinates + i * num_dimensions, coordinates + (i + 1) * num_dimensions, coordinates_.begin());
+    weights[i] = computeWeight(coordinates_);
+  }
+}
+
+double ProcessIntegrand::computeWeight(const std::vector<double>& x) {
+  if (storage_)
+    timer_->reset();  // start the timer (only used to fill the stored events metadata)
 
   process().clearEvent();
   auto weight = process().weight(x);  // specify the phase space point to probe and calculate weight
@@ -97,47 +172,39 @@ double ProcessIntegrand::eval(const std::vector<double>& x) {
 
   if (!process_->hasEvent())  // speed up the integration process if no event is to be generated
     return weight;
+  if (!storage_ && taming_functions_.empty() && eventModifiers().empty() && cuts_->empty())
+    return weight;  // weighted fast path: nothing requires the event content to be built
   process_->setKinematics();           // fill in the process' Event object
   auto* event = process_->eventPtr();  // prepare the event content
 
   // once kinematics variables computed, can apply taming functions
-  for (const auto& taming_function : run_parameters_->tamingFunctions())
-    if (const auto val = (*taming_function)(bws_.get(*event, taming_function->variables().at(0))) != 0.)
+  for (size_t i = 0; i < taming_functions_.size(); ++i)
+    if (const auto val = (*taming_functions_[i])(taming_variables_[i](*event)); val != 0.)
       weight *= val;
     else
       return 0.;
 
-  if (storage_)
-    event->metadata["time:generation"] = timer_->elapsed();  // pure CepGen part of the event generation
+  if (storage_)  // pure CepGen part of the event generation
+    event->metadata[Event::EventMetadata::TIME_GENERATION] = timer_->elapsed();
 
   {  // run all event modification algorithms
     double branching_ratio = -1.;
-    for (auto& event_modifier : run_parameters_->eventModifiersSequence()) {
+    for (auto& event_modifier : eventModifiers()) {
       if (!event_modifier->run(*event, branching_ratio, !storage_) || branching_ratio == 0.)
         return 0.;
       weight *= branching_ratio;  // branching fraction for all decays
     }
   }
-  const auto& kinematics = process_->kinematics();
-  if (!kinematics.cuts().central.contain((*event)(Particle::Role::CentralSystem)))
-    // apply cuts on final state system (after event modification algorithms)
-    // (polish your cuts, as this might be very time-consuming...)
-    return 0.;
-  for (const auto& part : (*event)(Particle::Role::CentralSystem))
-    // retrieve all cuts associated to this final state particle in the central system
-    if (kinematics.cuts().central_particles.count(part.pdgId()) > 0 &&
-        !kinematics.cuts().central_particles.at(part.pdgId()).contain({part}))
+  if (!cuts_->empty()) {
+    // apply cuts on final state system (after event modification algorithms), using a minimal kinematic record
+    kinematic_record_.fill(*event, cuts_->hasRemnantsCuts());
+    if (!cuts_->contain(kinematic_record_))
       return 0.;
-  if (!kinematics.incomingBeams().positive().elastic() &&
-      !kinematics.cuts().remnants.contain((*event)(Particle::Role::OutgoingBeam1), event))
-    return 0.;
-  if (!kinematics.incomingBeams().negative().elastic() &&
-      !kinematics.cuts().remnants.contain((*event)(Particle::Role::OutgoingBeam2), event))
-    return 0.;
+  }
 
   if (storage_) {  // add generation metadata to the event
-    event->metadata["weight"] = weight;
-    event->metadata["time:total"] = timer_->elapsed();
+    event->metadata[Event::EventMetadata::WEIGHT] = weight;
+    event->metadata[Event::EventMetadata::TIME_TOTAL] = timer_->elapsed();
   }
 
   CG_DEBUG_LOOP("ProcessIntegrand") << "[process " << std::hex << dynamic_cast<void*>(process_.get()) << std::dec
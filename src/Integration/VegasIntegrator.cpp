@@ -18,6 +18,7 @@
 
 #include <gsl/gsl_monte_vegas.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include "CepGen/Core/Exception.h"
@@ -117,6 +118,7 @@ public:
                     absolute_error,
                     gsl_monte_vegas_chisq(vegas_state_.get()));
     } while (std::fabs(gsl_monte_vegas_chisq(vegas_state_.get()) - 1.) > chi_square_cut_ - 1.);
+    r_boxes_ = static_cast<size_t>(std::pow(vegas_state_->bins, integrand.size()));
     CG_DEBUG("Integrator:integrate") << "Vegas grid information:\n\t"
                                      << "ran for " << vegas_state_->dim << " dimensions, "
                                      << "and generated " << vegas_state_->bins_max << " bins.\n\t"
@@ -125,6 +127,29 @@ public:
     return Value{result, absolute_error};
   }
 
+  std::vector<double> gridState() const override {
+    if (!vegas_state_ || r_boxes_ == 0)
+      return {};
+    std::vector<double> state{static_cast<double>(vegas_state_->bins), static_cast<double>(vegas_state_->dim)};
+    state.insert(state.end(), vegas_state_->xi, vegas_state_->xi + (vegas_state_->bins + 1) * vegas_state_->dim);
+    return state;
+  }
+
+  bool restoreGridState(const std::vector<double>& state) override {
+    if (state.size() < 2)
+      return false;
+    const auto bins = static_cast<size_t>(state.at(0)), num_dimensions = static_cast<size_t>(state.at(1));
+    if (num_dimensions == 0 || state.size() != 2 + (bins + 1) * num_dimensions)
+      return false;
+    vegas_state_.reset(gsl_monte_vegas_alloc(num_dimensions));
+    if (bins > vegas_state_->bins_max)
+      return false;
+    vegas_state_->bins = bins;
+    std::copy(state.begin() + 2, state.end(), vegas_state_->xi);
+    r_boxes_ = static_cast<size_t>(std::pow(vegas_state_->bins, num_dimensions));
+    return true;
+  }
+
   enum class Mode { importance = 1, importanceOnly = 0, stratified = -1 };
   friend std::ostream& operator<<(std::ostream& os, const Mode& mode) {
     switch (mode) {
@@ -166,10 +191,11 @@ private:
     if (!treat_)  // by default, no grid treatment
       return integrand.eval(coordinates);
     // treatment of the integration grid
-    if (r_boxes_ == 0) {
-      r_boxes_ = static_cast<size_t>(std::pow(vegas_state_->bins, integrand.size()));
-      treated_coordinates_.resize(integrand.size());
-    }
+    if (!vegas_state_ || r_boxes_ == 0)
+      throw CG_FATAL("VegasIntegrator:eval") << "Vegas grid was not prepared prior to the grid treatment!";
+    // one coordinates buffer per thread, as this method may be called concurrently by several generator workers
+    thread_local std::vector<double> treated_coordinates;
+    treated_coordinates.resize(integrand.size());
     double weight = r_boxes_;
     for (size_t j = 0; j < integrand.size(); ++j) {
       // find surrounding coordinates and interpolate
@@ -178,10 +204,10 @@ private:
       const double rel_pos = z - id;           // position between coordinates (norm.)
       const double bin_width = id == 0 ? COORD(1, j) : COORD(id + 1, j) - COORD(id, j);
       // build new coordinate from linear interpolation
-      treated_coordinates_[j] = COORD(id + 1, j) - bin_width * (1. - rel_pos);
+      treated_coordinates[j] = COORD(id + 1, j) - bin_width * (1. - rel_pos);
       weight *= bin_width;
     }
-    return weight * integrand.eval(treated_coordinates_);
+    return weight * integrand.eval(treated_coordinates);
   }
 
   const int num_function_calls_;
@@ -196,7 +222,6 @@ private:
 
   /// A Vegas integrator state for integration (optional) and/or "treated" event generation
   std::unique_ptr<gsl_monte_vegas_state, gsl_monte_vegas_deleter> vegas_state_{nullptr};
-  mutable unsigned long long r_boxes_{0ull};
-  mutable std::vector<double> treated_coordinates_;
+  unsigned long long r_boxes_{0ull};  ///< Number of boxes in the Vegas grid
 };
 REGISTER_INTEGRATOR("Vegas", VegasIntegrator);
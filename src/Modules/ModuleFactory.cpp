@@ -18,13 +18,15 @@
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/RunParameters.h"
+#include "CepGen/Generator.h"
 #include "CepGen/Modules/ModuleFactory.h"
 #include "CepGen/Utils/String.h"
 
 using namespace cepgen;
 
 template <typename T>
-ModuleFactory<T>::ModuleFactory(const std::string& description) : description_(description) {}
+ModuleFactory<T>::ModuleFactory(const std::string& description, const std::vector<std::string>& macros)
+    : description_(description), macros_(macros) {}
 
 template <typename T>
 std::unique_ptr<T> ModuleFactory<T>::build(const ParametersList& params) const {
@@ -34,7 +36,7 @@ std::unique_ptr<T> ModuleFactory<T>::build(const ParametersList& params) const {
                                     << "Parameters: " << params << ".\n"
                                     << "Registered modules: " << modules() << ".";
   const auto& idx = params.name();
-  if (map_.count(idx) == 0)
+  if (!has(idx))
     throw CG_FATAL("ModuleFactory") << description_ << " failed to build a module with name '" << idx << "'.\n"
                                     << "Registered modules: " << modules() << ".";
   ParametersList plist(describeParameters(idx).validate(params));
@@ -64,7 +66,7 @@ std::unique_ptr<T> ModuleFactory<T>::build(const std::string& name, const Parame
 
 template <typename T>
 std::unique_ptr<T> ModuleFactory<T>::build(int index, const ParametersList& params) const {
-  if (indices_.count(index) > 0)
+  if (indices_.count(index) > 0 || (loadModule(std::to_string(index), macros_) && indices_.count(index) > 0))
     return build(indices_.at(index), params);
   const auto& mod_names = modules();
   if (const auto str_index = std::to_string(index);
@@ -87,7 +89,7 @@ ParametersDescription ModuleFactory<T>::describeParameters(const ParametersList&
                                     << "Parameters: " << parameters << ".\n"
                                     << "Registered modules: " << modules() << ".";
   const auto& idx = parameters.name();
-  if (params_map_.count(idx) == 0)
+  if (!has(idx))
     throw CG_FATAL("ModuleFactory") << "No parameters description were found for module name '" << idx << "'.\n"
                                     << "Registered modules: " << modules() << ".";
   return params_map_.at(idx).steer(parameters);
@@ -98,7 +100,7 @@ ParametersDescription ModuleFactory<T>::describeParameters(const std::string& na
                                                            const ParametersList& params) const {
   const auto extra_params = utils::split(name, '<');
   const auto mod_name = extra_params.at(0);
-  if (params_map_.count(mod_name) == 0)
+  if (!has(mod_name))
     return ParametersDescription().setName(mod_name).setDescription("{module without description}").steer(params);
   auto description = params_map_.at(mod_name).steer(params);
   auto extra_params_obj = ParametersList();
@@ -110,7 +112,7 @@ ParametersDescription ModuleFactory<T>::describeParameters(const std::string& na
 
 template <typename T>
 ParametersDescription ModuleFactory<T>::describeParameters(int index, const ParametersList& params) const {
-  if (indices_.count(index) > 0)
+  if (indices_.count(index) > 0 || (loadModule(std::to_string(index), macros_) && indices_.count(index) > 0))
     return describeParameters(indices_.at(index), params);
   const auto& mod_names = modules();
   if (const auto str_index = std::to_string(index);
@@ -122,9 +124,14 @@ ParametersDescription ModuleFactory<T>::describeParameters(int index, const Para
 
 template <typename T>
 std::vector<std::string> ModuleFactory<T>::modules() const {
+  loadAllModules();  // ensure the list is complete
   std::vector<std::string> out;
   std::transform(map_.begin(), map_.end(), std::back_inserter(out), [](const auto& val) { return val.first; });
   std::sort(out.begin(), out.end());
   return out;
 }
+template <typename T>
+bool ModuleFactory<T>::has(const std::string& name) const {
+  return map_.count(name) > 0 || (loadModule(name, macros_) && map_.count(name) > 0);
+}
 #include "CepGen/Modules/ModuleFactoryImpl.h"
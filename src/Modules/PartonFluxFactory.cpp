@@ -20,7 +20,6 @@
 #include "CepGen/Modules/PartonFluxFactory.h"
 #include "CepGen/PartonFluxes/CollinearFlux.h"
 #include "CepGen/PartonFluxes/KTFlux.h"
-#include "CepGen/Utils/Collections.h"
 #include "CepGen/Utils/String.h"
 
 using namespace cepgen;
@@ -28,9 +27,9 @@ using namespace cepgen;
 ParametersDescription PartonFluxFactory::describeParameters(const std::string& name, const ParametersList& params) {
   if (name.empty())
     throw CG_FATAL("PartonFluxFactory:describeParameters") << "No name given to describe parton flux modelling.";
-  if (utils::contains(CollinearFluxFactory::get().modules(), name))
+  if (CollinearFluxFactory::get().has(name))
     return CollinearFluxFactory::get().describeParameters(name, params);
-  if (utils::contains(KTFluxFactory::get().modules(), name))
+  if (KTFluxFactory::get().has(name))
     return KTFluxFactory::get().describeParameters(name, params);
   return ParametersDescription().setName(name);
 }
@@ -39,9 +38,9 @@ bool PartonFluxFactory::elastic(const ParametersList& params) {
   const auto& name = params.name();
   if (name.empty())
     throw CG_FATAL("PartonFluxFactory:elastic") << "No name given to get parton flux modelling elasticity.";
-  if (utils::contains(CollinearFluxFactory::get().modules(), name))
+  if (CollinearFluxFactory::get().has(name))
     return !CollinearFluxFactory::get().build(name, params)->fragmenting();
-  if (utils::contains(KTFluxFactory::get().modules(), name))
+  if (KTFluxFactory::get().has(name))
     return !KTFluxFactory::get().build(name, params)->fragmenting();
   throw CG_FATAL("PartonFluxFactory:elastic") << "Failed to find a parton flux with name '" << name << "'.";
 }
@@ -50,9 +49,9 @@ spdgid_t PartonFluxFactory::partonPdgId(const ParametersList& params) {
   const auto& name = params.name();
   if (name.empty())
     throw CG_FATAL("PartonFluxFactory:partonPdgId") << "No name given to get parton flux modelling PDG id.";
-  if (utils::contains(CollinearFluxFactory::get().modules(), name))
+  if (CollinearFluxFactory::get().has(name))
     return CollinearFluxFactory::get().build(name, params)->partonPdgId();
-  if (utils::contains(KTFluxFactory::get().modules(), name))
+  if (KTFluxFactory::get().has(name))
     return KTFluxFactory::get().build(name, params)->partonPdgId();
   throw CG_FATAL("PartonFluxFactory:partonPdgId") << "Failed to find a parton flux with name '" << name << "'.";
 }
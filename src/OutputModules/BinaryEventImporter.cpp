@@ -0,0 +1,69 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventImporter.h"
+#include "CepGen/Modules/EventImporterFactory.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+/// Native binary events file input module
+/// \note The file is mapped into memory, and events are decoded in place from its content. Several importers may
+///  read disjoint subsets of a single file (e.g. from several threads) through the first event index and stride
+///  parameters.
+class BinaryEventImporter final : public EventImporter {
+public:
+  explicit BinaryEventImporter(const ParametersList& params)
+      : EventImporter(params),
+        reader_(steer<std::string>("filename")),
+        next_event_(steer<int>("firstEvent")),
+        stride_(steer<int>("stride")) {
+    if (steer<int>("firstEvent") < 0 || steer<int>("stride") <= 0)
+      throw CG_FATAL("BinaryEventImporter") << "Invalid events reading pattern: first event index "
+                                            << steer<int>("firstEvent") << ", stride " << steer<int>("stride") << ".";
+    setCrossSection(reader_.crossSection());
+    CG_INFO("BinaryEventImporter") << "Binary events file '" << steer<std::string>("filename") << "' opened with "
+                                   << reader_.size() << " event(s).";
+  }
+
+  static ParametersDescription description() {
+    auto desc = EventImporter::description();
+    desc.setDescription("Native binary events file input module");
+    desc.add("filename", "output.cgevt"s).setDescription("Input filename");
+    desc.add("firstEvent", 0).setDescription("index of the first event to read");
+    desc.add("stride", 1).setDescription("step between two consecutive events indices to read");
+    return desc;
+  }
+
+  bool operator>>(Event& event) override {
+    if (next_event_ >= reader_.size())
+      return false;
+    reader_.read(next_event_, event);
+    next_event_ += stride_;
+    return true;
+  }
+
+private:
+  const utils::BinaryEventReader reader_;
+  size_t next_event_;
+  const size_t stride_;
+};
+REGISTER_EVENT_IMPORTER("binary", BinaryEventImporter);
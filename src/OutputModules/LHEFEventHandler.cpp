@@ -0,0 +1,262 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+#ifdef CEPGEN_ZLIB
+#include <zlib.h>
+#endif
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Modules/EventExporterFactory.h"
+#include "CepGen/Physics/PDG.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/String.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace cepgen;
+using namespace std::string_literals;
+
+/// Native Les Houches event file output module
+/// \note Events are formatted into an in-memory buffer, flushed to the output file (possibly through a streaming
+///  gzip compression) once it reaches a user-defined size. The event content (incoming partons, beam remnants, and
+///  central system) and particles parentage follow the conventions of the Pythia 8-based LHEF output module.
+class LHEFEventHandler final : public EventExporter {
+public:
+  explicit LHEFEventHandler(const ParametersList& params)
+      : EventExporter(params),
+        filename_(steer<std::string>("filename")),
+        buffer_size_(steer<int>("bufferSize")),
+        colour_index_(steer<int>("colourIndex")) {
+    if (utils::fileExtension(filename_) == ".gz") {
+#ifdef CEPGEN_ZLIB
+      const auto mode = "wb" + std::to_string(std::clamp(steer<int>("compressionLevel"), 0, 9));
+      if (gz_file_ = gzopen(filename_.data(), mode.data()); gz_file_ == nullptr)
+        throw CG_FATAL("LHEFEventHandler") << "Failed to open output filename '" << filename_ << "' for writing.";
+      gzbuffer(gz_file_, 1 << 17);
+#else
+      CG_WARNING("LHEFEventHandler") << "gzip compression requested, but zlib was not found at compile time. "
+                                     << "Will write an uncompressed output.";
+      utils::replaceAll(filename_, ".gz", "");
+#endif
+    }
+    if (!compressed()) {
+      file_.open(filename_, std::ios::binary);
+      if (!file_.is_open())
+        throw CG_FATAL("LHEFEventHandler") << "Failed to open output filename '" << filename_ << "' for writing.";
+    }
+    buffer_.reserve(buffer_size_ + 4096);
+  }
+  ~LHEFEventHandler() override {
+    if (!header_written_)
+      writeHeader();
+    buffer_ += "</LesHouchesEvents>\n";
+    flush();
+#ifdef CEPGEN_ZLIB
+    if (compressed())
+      gzclose(gz_file_);
+#endif
+  }
+
+  static ParametersDescription description() {
+    auto desc = EventExporter::description();
+    desc.setDescription("Native LHEF output module");
+    desc.add("filename", "output.lhe"s).setDescription("Output filename (gzip-compressed if ending with '.gz')");
+    desc.add("compressionLevel", 6).setDescription("gzip compression level (0-9)");
+    desc.add("bufferSize", 1 << 20).setDescription("size of the output buffer, in bytes");
+    desc.add("colourIndex", 501).setDescription("colour index of the coloured central system particles");
+    return desc;
+  }
+
+  void setCrossSection(const Value& cross_section) override {
+    if (header_written_)
+      CG_WARNING("LHEFEventHandler") << "Cross section set after the initialisation block was written. "
+                                     << "It will not be stored in the output file.";
+    cross_section_ = cross_section;
+  }
+  bool operator<<(const Event& event) override {
+    if (!header_written_)
+      writeHeader();
+    // build the LHE particles list, and the CepGen-to-LHE indices association table
+    particles_.clear();
+    lhe_ids_.assign(event.size(), 0);
+    if (event.hasRole(Particle::Role::Parton1) && event.hasRole(Particle::Role::Parton2))
+      for (const auto& role : {Particle::Role::Parton1, Particle::Role::Parton2})
+        addParticle(event(role).at(0), -2);
+    for (const auto& role : {Particle::Role::OutgoingBeam1, Particle::Role::OutgoingBeam2})
+      if (event.hasRole(role))
+        for (const auto& part : event(role))
+          addParticle(part, isDecayed(part) ? 2 : 1);
+    if (event.hasRole(Particle::Role::CentralSystem))
+      for (const auto& part : event(Particle::Role::CentralSystem))
+        addParticle(part, part.status() == Particle::Status::Resonance ? 2 : 1);
+
+    const auto scale = event.hasRole(Particle::Role::Intermediate)
+                           ? event(Particle::Role::Intermediate).at(0).momentum().mass()
+                           : 0.;
+    append("<event>\n%3zu %4d %+15.8e %15.8e %15.8e %15.8e\n",
+           particles_.size(),
+           kProcessId,
+           1.,
+           scale,
+           event.metadata(Event::EventMetadata::ALPHA_EM),
+           event.metadata(Event::EventMetadata::ALPHA_S));
+    for (const auto& [part, status] : particles_) {
+      const auto [moth1, moth2] = mothers(event, *part);
+      const auto& mom = part->momentum();
+      int col1 = 0, col2 = 0;
+      if (part->role() == Particle::Role::CentralSystem && colours(part->pdgId()) > 1)
+        (part->integerPdgId() > 0 ? col1 : col2) = colour_index_;
+      append("%8ld %3d %4d %4d %4d %4d %+17.10e %+17.10e %+17.10e %17.10e %17.10e %4.1f %4.1f\n",
+             part->integerPdgId(),
+             status,
+             moth1,
+             moth2,
+             col1,
+             col2,
+             mom.px(),
+             mom.py(),
+             mom.pz(),
+             mom.energy(),
+             mom.mass(),
+             0.,
+             9.);
+    }
+    buffer_ += "</event>\n";
+    if (buffer_.size() >= buffer_size_)
+      flush();
+    return true;
+  }
+
+private:
+  void initialise() override {
+    banner_ = banner();
+    if (runParameters().hasProcess()) {
+      const auto& beams = runParameters().kinematics().incomingBeams();
+      beams_pdg_ = {beams.positive().integerPdgId(), beams.negative().integerPdgId()};
+      beams_energy_ = {beams.positive().momentum().energy(), beams.negative().momentum().energy()};
+    }
+  }
+  /// Are events written through a compressed stream?
+  inline bool compressed() const {
+#ifdef CEPGEN_ZLIB
+    return gz_file_ != nullptr;
+#else
+    return false;
+#endif
+  }
+  /// Format a printf-like expression at the end of the output buffer
+  template <typename... Args>
+  void append(const char* format, Args... args) {
+    char line[256];
+    if (const auto size = std::snprintf(line, sizeof(line), format, args...); size > 0)
+      buffer_.append(line, std::min<size_t>(size, sizeof(line) - 1));
+  }
+  /// Write the header and initialisation blocks
+  void writeHeader() {
+    buffer_ += "<LesHouchesEvents version=\"3.0\">\n<header>\n<!--\n" + banner_ + "\n-->\n</header>\n<init>\n";
+    append("%8ld %8ld %15.8e %15.8e %4d %4d %4d %4d %4d %4d\n",
+           beams_pdg_.at(0),
+           beams_pdg_.at(1),
+           beams_energy_.at(0),
+           beams_energy_.at(1),
+           0,
+           0,
+           0,
+           0,
+           3,  // unit-weight events
+           1);
+    append("%15.8e %15.8e %15.8e %4d\n",
+           static_cast<double>(cross_section_),
+           cross_section_.uncertainty(),
+           1.,
+           kProcessId);
+    buffer_ += "</init>\n";
+    header_written_ = true;
+  }
+  /// Write the buffer content to the output file
+  void flush() {
+    if (buffer_.empty())
+      return;
+#ifdef CEPGEN_ZLIB
+    if (compressed()) {
+      if (gzwrite(gz_file_, buffer_.data(), buffer_.size()) != static_cast<int>(buffer_.size()))
+        CG_ERROR("LHEFEventHandler") << "Failed to write compressed events block into '" << filename_ << "'.";
+      buffer_.clear();
+      return;
+    }
+#endif
+    file_.write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+  }
+  void addParticle(const Particle& part, int status) {
+    particles_.emplace_back(&part, status);
+    lhe_ids_.at(part.id()) = particles_.size();  // LHE indices start at 1
+  }
+  /// LHE indices of the first and last mothers of a particle (or of its first mother's mothers if not stored)
+  std::pair<int, int> mothers(const Event& event, const Particle& part) const {
+    const auto& moth_ids = part.mothers();
+    if (moth_ids.empty())
+      return {0, 0};
+    std::pair<int, int> out{lhe_ids_.at(*moth_ids.begin()), 0};
+    if (out.first == 0) {  // mother not stored, look for its own parentage
+      const auto moth_moth_ids = event(*moth_ids.begin()).mothers();
+      if (!moth_moth_ids.empty())
+        out = {lhe_ids_.at(*moth_moth_ids.begin()), lhe_ids_.at(*moth_moth_ids.rbegin())};
+    }
+    if (moth_ids.size() > 1)
+      out.second = lhe_ids_.at(*moth_ids.rbegin());
+    return out;
+  }
+  static bool isDecayed(const Particle& part) {
+    return part.status() == Particle::Status::Resonance || part.status() == Particle::Status::Fragmented;
+  }
+  /// Colour factor of a particle (1 if not defined)
+  static double colours(pdgid_t pdg_id) {
+    try {
+      return PDG::get().colours(pdg_id);
+    } catch (const Exception&) {
+      return 1.;
+    }
+  }
+
+  static constexpr int kProcessId = 1;  ///< LHE process identifier
+
+  std::string filename_;
+  std::ofstream file_;
+#ifdef CEPGEN_ZLIB
+  gzFile gz_file_{nullptr};
+#endif
+  const size_t buffer_size_;
+  const int colour_index_;
+  std::string banner_;
+  std::array<long, 2> beams_pdg_{0, 0};
+  std::array<double, 2> beams_energy_{0., 0.};
+  Value cross_section_{0., 0.};
+  bool header_written_{false};
+  std::string buffer_;                                       ///< Output buffer, flushed to the file once full
+  std::vector<std::pair<const Particle*, int> > particles_;  ///< Particles (and LHE status) stored for this event
+  std::vector<int> lhe_ids_;                                 ///< CepGen-to-LHE particle indices association table
+};
+REGISTER_EXPORTER("lhef", LHEFEventHandler);
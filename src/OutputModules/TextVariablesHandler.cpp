@@ -36,7 +36,10 @@ public:
       : EventExporter(params),
         file_(steer<std::string>("filename")),
         variables_(steer<std::vector<std::string> >("variables")),
-        separator_(steer<std::string>("separator")) {}
+        separator_(steer<std::string>("separator")) {
+    for (const auto& variable : variables_)
+      accessors_.emplace_back(browser_.compile(variable));
+  }
 
   static ParametersDescription description() {
     auto desc = EventExporter::description();
@@ -53,8 +56,8 @@ public:
     if (variables_.empty())
       return true;
     std::string sep;
-    for (const auto& var : variables_)  // write down the variables list in the file
-      file_ << sep << browser_.get(ev, var), sep = separator_;
+    for (const auto& accessor : accessors_)  // write down the variables list in the file
+      file_ << sep << accessor(ev), sep = separator_;
     file_ << "\n";
     return true;
   }
@@ -72,5 +75,6 @@ private:
   const std::string separator_;
 
   const utils::EventBrowser browser_;
+  std::vector<utils::EventBrowser::Accessor> accessors_;  ///< Compiled variables accessors
 };
 REGISTER_EXPORTER("vars", TextVariablesHandler);
@@ -17,6 +17,8 @@
  */
 
 #include <cmath>
+#include <mutex>
+#include <thread>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/Integrator.h"
@@ -25,10 +27,15 @@
 #include "CepGen/PartonFluxes/CollinearFlux.h"
 #include "CepGen/PartonFluxes/KTFlux.h"
 #include "CepGen/Physics/PDG.h"
+#include "CepGen/Utils/CubicStencil.h"
 #include "CepGen/Utils/FunctionWrapper.h"
+#include "CepGen/Utils/GridHandler.h"
 #include "CepGen/Utils/Limits.h"
+#include "CepGen/Utils/Message.h"
+#include "CepGen/Utils/TabulationCache.h"
 
 using namespace cepgen;
+using namespace std::string_literals;
 
 class KTIntegratedFlux : public CollinearFlux {
 public:
@@ -36,14 +43,16 @@ public:
       : CollinearFlux(params),
         integrator_(IntegratorFactory::get().build(steer<ParametersList>("integrator"))),
         flux_(KTFluxFactory::get().build(steer<ParametersList>("ktFlux"))),
-        kt2_range_(steer<Limits>("kt2range")) {
+        kt2_range_(steer<Limits>("kt2range")),
+        tabulate_(steer<bool>("tabulate")) {
     if (!flux_->ktFactorised())
       throw CG_FATAL("GammaIntegrated") << "Input flux has to be unintegrated.";
     // initialise the functions to integrate
     CG_INFO("KTIntegratedFlux") << "kt flux-integrated collinear flux evaluator initialised.\n\t"
                                 << "Integrator: " << integrator_->name() << "\n\t"
                                 << "Q^2 integration range: " << kt2_range_ << " GeV^2\n\t"
-                                << "Unintegrated flux: " << flux_->name() << ".";
+                                << "Unintegrated flux: " << flux_->name() << ".\n\t"
+                                << "Tabulated: " << std::boolalpha << tabulate_ << ".";
   }
 
   bool fragmenting() const final { return flux_->fragmenting(); }
@@ -59,26 +68,185 @@ public:
         .setDescription("Type of unintegrated kT-dependent parton flux");
     desc.add("kt2range", Limits{0., 1.e4})
         .setDescription("kinematic range for the parton transverse virtuality, in GeV^2");
+    desc.add("tabulate", false).setDescription("tabulate the kt-integrated flux in (log x, log Q^2/mX^2)?");
+    desc.add("xTabRange", Limits{1.e-6, 1.}).setDescription("parton momentum fraction range to tabulate");
+    desc.add("q2TabRange", Limits{1.e-6, 1.e4}).setDescription("virtuality range to tabulate (in GeV^2)");
+    desc.add("mx2TabRange", Limits{1.e-6, 1.e4}).setDescription("diffractive mass range to tabulate (in GeV^2)");
+    desc.add("numXPoints", 200).setDescription("number of (log-uniform) tabulation points in x");
+    desc.add("numScalePoints", 100).setDescription("number of (log-uniform) tabulation points in Q^2/mX^2");
+    desc.add("numThreads", 0).setDescription("number of threads for the tabulation (0 = all hardware threads)");
+    desc.add("cacheDirectory", ""s)
+        .setDescription("if set, directory where tabulations are persisted for subsequent runs");
     return desc;
   }
 
   double fluxQ2(double x, double q2) const override {
     if (!x_range_.contains(x, true))
       return 0.;
-    return 2. * M_PI *
-           integrator_->integrate([this, &x, &q2](double kt2) { return flux_->fluxQ2(x, kt2, q2); }, kt2_range_);
+    if (tabulate_) {
+      std::call_once(q2_table_built_, [this] { q2_table_ = table(Scale::q2); });
+      if (const auto lx = std::log(x), lq2 = std::log(q2); q2_table_->contains(lx, lq2))
+        return q2_table_->interpolate(lx, lq2);
+    }
+    return integrate(*integrator_, *flux_, Scale::q2, x, q2);
   }
 
   double fluxMX2(double x, double mx2) const override {
     if (!x_range_.contains(x, true))
       return 0.;
-    return 2. * M_PI *
-           integrator_->integrate([this, &x, &mx2](double kt2) { return flux_->fluxMX2(x, kt2, mx2); }, kt2_range_);
+    if (tabulate_) {
+      std::call_once(mx2_table_built_, [this] { mx2_table_ = table(Scale::mx2); });
+      if (const auto lx = std::log(x), lmx2 = std::log(mx2); mx2_table_->contains(lx, lmx2))
+        return mx2_table_->interpolate(lx, lmx2);
+    }
+    return integrate(*integrator_, *flux_, Scale::mx2, x, mx2);
   }
 
 private:
+  enum struct Scale { q2, mx2 };  ///< Second argument of the collinear flux
+  /// Integrate the unintegrated flux over the parton transverse virtuality range
+  double integrate(Integrator& integrator, const KTFlux& flux, Scale scale, double x, double mu2) const {
+    if (scale == Scale::q2)
+      return 2. * M_PI *
+             integrator.integrate([&flux, &x, &mu2](double kt2) { return flux.fluxQ2(x, kt2, mu2); }, kt2_range_);
+    return 2. * M_PI *
+           integrator.integrate([&flux, &x, &mu2](double kt2) { return flux.fluxMX2(x, kt2, mu2); }, kt2_range_);
+  }
+
+  /// Tabulation of the kt-integrated flux, regular in \f$(\log x,\log Q^2)\f$ or \f$(\log x,\log m_X^2)\f$
+  class Table {
+  public:
+    explicit Table(const KTIntegratedFlux& flux, Scale scale, const std::string& key)
+        : scale_name_(scale == Scale::q2 ? "Q^2" : "mX^2"),
+          x_range_(flux.steer<Limits>("xTabRange")),
+          mu2_range_(flux.steer<Limits>(scale == Scale::q2 ? "q2TabRange" : "mx2TabRange")),
+          lx_range_(std::log(x_range_.min()), std::log(x_range_.max())),
+          lmu2_range_(std::log(mu2_range_.min()), std::log(mu2_range_.max())),
+          num_x_(flux.steer<int>("numXPoints")),
+          num_mu2_(flux.steer<int>("numScalePoints")),
+          dlx_(lx_range_.range() / (num_x_ - 1)),
+          dlmu2_(lmu2_range_.range() / (num_mu2_ - 1)) {
+      if (num_x_ < 4 || num_mu2_ < 4)
+        throw CG_FATAL("KTIntegratedFlux") << "At least 4 tabulation points are required along each axis, got "
+                                           << num_x_ << "x" << num_mu2_ << ".";
+      if (x_range_.min() <= 0. || mu2_range_.min() <= 0. || !lx_range_.valid() || !lmu2_range_.valid())
+        throw CG_FATAL("KTIntegratedFlux") << "Invalid tabulation range: x in " << x_range_ << ", " << scale_name_
+                                           << " in " << mu2_range_ << ".";
+      const utils::TabulationCache cache(flux.steer<std::string>("cacheDirectory"), "KTIntegratedFlux", key);
+      if (load(cache)) {
+        CG_INFO("KTIntegratedFlux") << "kt-integrated flux retrieved from '" << cache.path() << "'.";
+        return;
+      }
+      build(flux, scale);
+      if (cache.enabled())
+        save(cache);
+    }
+
+    /// Is the point within the tabulated range?
+    inline bool contains(double lx, double lmu2) const {
+      return lx >= lx_range_.min() && lx <= lx_range_.max() && lmu2 >= lmu2_range_.min() && lmu2 <= lmu2_range_.max();
+    }
+    /// Bicubic (Catmull-Rom) interpolation of the tabulated flux
+    inline double interpolate(double lx, double lmu2) const {
+      const auto stencil_x = utils::CubicStencil::regular((lx - lx_range_.min()) / dlx_, num_x_),
+                 stencil_mu2 = utils::CubicStencil::regular((lmu2 - lmu2_range_.min()) / dlmu2_, num_mu2_);
+      const auto &wx = stencil_x.weights, &wmu2 = stencil_mu2.weights;
+      double out = 0.;
+      for (size_t i = 0; i < 4; ++i) {
+        const auto* row = &values_[(stencil_x.first + i) * num_mu2_ + stencil_mu2.first];
+        out += wx[i] * (wmu2[0] * row[0] + wmu2[1] * row[1] + wmu2[2] * row[2] + wmu2[3] * row[3]);
+      }
+      return std::max(out, 0.);
+    }
+
+  private:
+    /// Compute all nodes, distributing the integrations among several threads
+    /// \note Each thread owns a copy of the integrator and unintegrated flux, none of which being thread-safe
+    void build(const KTIntegratedFlux& flux, Scale scale) {
+      values_.assign(num_x_ * num_mu2_, 0.);
+      auto num_threads = static_cast<size_t>(std::max(flux.steer<int>("numThreads"), 0));
+      if (num_threads == 0)
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+      num_threads = std::min(num_threads, num_x_);
+      std::vector<std::unique_ptr<Integrator> > integrators;
+      std::vector<std::unique_ptr<KTFlux> > fluxes;
+      for (size_t i = 0; i < num_threads; ++i) {  // factories are not thread-safe, build all objects beforehand
+        integrators.emplace_back(IntegratorFactory::get().build(flux.steer<ParametersList>("integrator")));
+        fluxes.emplace_back(KTFluxFactory::get().build(flux.steer<ParametersList>("ktFlux")));
+      }
+      auto fill = [&](size_t thread_id) {
+        for (size_t i = thread_id; i < num_x_; i += num_threads)
+          for (size_t j = 0; j < num_mu2_; ++j) {
+            const auto value = flux.integrate(*integrators.at(thread_id),
+                                              *fluxes.at(thread_id),
+                                              scale,
+                                              std::exp(lx_range_.min() + i * dlx_),
+                                              std::exp(lmu2_range_.min() + j * dlmu2_));
+            values_[i * num_mu2_ + j] = std::isfinite(value) ? value : 0.;
+          }
+      };
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < num_threads; ++i)
+        threads.emplace_back(fill, i);
+      fill(0);
+      for (auto& thread : threads)
+        thread.join();
+      CG_INFO("KTIntegratedFlux") << "kt-integrated flux tabulated on a " << num_x_ << "x" << num_mu2_
+                                  << " (log x, log " << scale_name_ << ") grid for x in " << x_range_ << " and "
+                                  << scale_name_ << " in " << mu2_range_ << " GeV^2, using " << num_threads
+                                  << " thread(s).";
+    }
+    /// Retrieve a table computed by a previous run, if compatible with the current binning
+    bool load(const utils::TabulationCache& cache) {
+      GridHandler<2, 1> grid(GridType::linear);
+      if (!cache.load(grid))
+        return false;
+      const auto values = grid.values();
+      if (values.size() != num_x_ * num_mu2_)
+        return false;
+      const auto matches = [](const Limits& lhs, const Limits& rhs) {  // up to the nodes positioning rounding
+        const auto tolerance = 1.e-9 * rhs.range();
+        return std::fabs(lhs.min() - rhs.min()) < tolerance && std::fabs(lhs.max() - rhs.max()) < tolerance;
+      };
+      if (const auto bounds = grid.boundaries();
+          !matches(bounds.at(0), lx_range_) || !matches(bounds.at(1), lmu2_range_)) {
+        CG_WARNING("KTIntegratedFlux") << "Cached kt-integrated flux binning (" << bounds.at(0) << "x" << bounds.at(1)
+                                       << ") is incompatible with the requested one (" << lx_range_ << "x"
+                                       << lmu2_range_ << ").";
+        return false;
+      }
+      values_.clear();
+      for (const auto& [coord, value] : values)  // nodes are ordered by x, then by scale
+        values_.emplace_back(value.at(0));
+      return true;
+    }
+    /// Store the table for subsequent runs
+    void save(const utils::TabulationCache& cache) const {
+      GridHandler<2, 1> grid(GridType::linear);
+      for (size_t i = 0; i < num_x_; ++i)
+        for (size_t j = 0; j < num_mu2_; ++j)
+          grid.insert({lx_range_.min() + i * dlx_, lmu2_range_.min() + j * dlmu2_}, {values_[i * num_mu2_ + j]});
+      grid.initialise();
+      cache.save(grid);
+    }
+
+    const std::string scale_name_;
+    const Limits x_range_, mu2_range_, lx_range_, lmu2_range_;
+    const size_t num_x_, num_mu2_;
+    const double dlx_, dlmu2_;
+    std::vector<double> values_;  ///< Flat array of tabulated values (x, scale)
+  };
+  /// Retrieve (or build) the table shared by all identical instances
+  std::shared_ptr<const Table> table(Scale scale) const {
+    const auto key = params_.serialise() + (scale == Scale::q2 ? ":Q2" : ":MX2");
+    return utils::SharedTabulations<const Table>::get(key, *this, scale, key);
+  }
+
   const std::unique_ptr<Integrator> integrator_;
   const std::unique_ptr<KTFlux> flux_;
   const Limits kt2_range_;
+  const bool tabulate_;
+  mutable std::once_flag q2_table_built_, mx2_table_built_;
+  mutable std::shared_ptr<const Table> q2_table_, mx2_table_;  ///< Tabulated fluxes (possibly shared among instances)
 };
 REGISTER_COLLINEAR_FLUX("KTIntegrated", KTIntegratedFlux);
@@ -16,6 +16,8 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <mutex>
+
 #include "CepGen/Modules/CouplingFactory.h"
 #include "CepGen/Physics/Coupling.h"
 #include "CepGen/Physics/PDG.h"
@@ -26,6 +28,8 @@ namespace {
   void initalphas_(int& iord, double& fr2, double& mur, double& asmur, double& mc, double& mb, double& mt);
   double alphas_(double& mur);
   }
+  /// Guard for the PEGASUS common blocks, shared by all instances (and threads)
+  std::mutex pegasus_mutex;
 }  // namespace
 
 using namespace cepgen;
@@ -40,6 +44,7 @@ public:
         alphas_mu_(steer<double>("asmur")) {
     double mc = PDG::get().mass(4), mb = PDG::get().mass(5), mt = PDG::get().mass(6);
 
+    const std::lock_guard<std::mutex> lock(pegasus_mutex);
     initalphas_(order_, fr2_, mu_, alphas_mu_, mc, mb, mt);
     CG_INFO("AlphaSPEGASUS:init") << "PEGASUS alpha(S) evolution algorithm initialised with parameters:\n\t"
                                   << "order: " << order_ << ", fr2: " << fr2_ << ", "
@@ -58,7 +63,10 @@ public:
     return desc;
   }
 
-  double operator()(double q) const override { return alphas_(q); }
+  double operator()(double q) const override {
+    const std::lock_guard<std::mutex> lock(pegasus_mutex);  // evolution is not reentrant
+    return alphas_(q);
+  }
 
 private:
   int order_;
@@ -0,0 +1,163 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Physics/CompiledCuts.h"
+#include "CepGen/Physics/Kinematics.h"
+
+using namespace cepgen;
+using namespace cepgen::cuts;
+
+namespace {
+  const Limits kPositive{0.};        ///< Physical range of a positive-defined quantity
+  const Limits kAngle{-M_PI, M_PI};  ///< Physical range of an azimuthal angles difference
+
+  /// Can a restriction reject any value of a quantity within its physical range?
+  bool active(const Limits& limits, const Limits& range = Limits{}) {
+    return (limits.hasMin() && (!range.hasMin() || limits.min() > range.min())) ||
+           (limits.hasMax() && (!range.hasMax() || limits.max() < range.max()));
+  }
+}  // namespace
+
+void KinematicRecord::fill(const Event& event, bool with_remnants) {
+  central.clear();
+  central_ids.clear();
+  for (const auto& part : event(Particle::Role::CentralSystem)) {
+    central.emplace_back(part.momentum());
+    central_ids.emplace_back(part.pdgId());
+  }
+  if (!with_remnants)
+    return;
+  size_t i = 0;
+  for (const auto& role : {Particle::Role::OutgoingBeam1, Particle::Role::OutgoingBeam2}) {
+    remnants[i].clear();
+    remnants_mother_pz[i].clear();
+    if (event.hasRole(role))
+      for (const auto& part : event(role)) {
+        if (part.status() != Particle::Status::FinalState)
+          continue;
+        remnants[i].emplace_back(part.momentum());
+        const auto& mothers = part.mothers();
+        remnants_mother_pz[i].emplace_back(!mothers.empty() ? event(*mothers.begin()).momentum().pz() : 0.);
+      }
+    ++i;
+  }
+}
+
+Compiled::Compiled(const Kinematics& kinematics) : central_(kinematics.cuts().central) {
+  for (const auto& [pdgid, cuts] : kinematics.cuts().central_particles)
+    if (System system(cuts); !system.empty())
+      central_particles_.emplace(pdgid, std::move(system));
+  dissociative_beams_ = {!kinematics.incomingBeams().positive().elastic(),
+                         !kinematics.incomingBeams().negative().elastic()};
+  remnants_yj_ = kinematics.cuts().remnants.yj;
+  remnants_xi_ = kinematics.cuts().remnants.xi;
+}
+
+bool Compiled::empty() const { return central_.empty() && central_particles_.empty() && !hasRemnantsCuts(); }
+
+bool Compiled::hasRemnantsCuts() const {
+  return (dissociative_beams_[0] || dissociative_beams_[1]) &&
+         (active(remnants_yj_, kPositive) || remnants_xi_.valid());
+}
+
+bool Compiled::contain(const KinematicRecord& record) const {
+  if (!central_.contain(record.central))
+    return false;
+  if (!central_particles_.empty())
+    for (size_t i = 0; i < record.central.size(); ++i)
+      if (const auto it = central_particles_.find(record.central_ids.at(i));
+          it != central_particles_.end() && !it->second.contain(record.central.at(i)))
+        return false;
+  if (hasRemnantsCuts())
+    for (size_t i = 0; i < 2; ++i) {
+      if (!dissociative_beams_.at(i))
+        continue;
+      for (size_t j = 0; j < record.remnants.at(i).size(); ++j) {
+        const auto& mom = record.remnants.at(i).at(j);
+        if (remnants_xi_.valid() && !remnants_xi_.contains(1. - mom.pz() / record.remnants_mother_pz.at(i).at(j)))
+          return false;
+        if (!remnants_yj_.contains(std::fabs(mom.rapidity())))
+          return false;
+      }
+    }
+  return true;
+}
+
+Compiled::System::System(const Central& cuts) {
+  if (const auto& lim = cuts.pt_single; active(lim, kPositive))
+    single.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.pt()); });
+  if (const auto& lim = cuts.eta_single; active(lim))
+    single.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.eta()); });
+  if (const auto& lim = cuts.rapidity_single; active(lim))
+    single.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.rapidity()); });
+  if (const auto& lim = cuts.energy_single; active(lim, kPositive))
+    single.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.energy()); });
+  if (const auto& lim = cuts.mass_single; active(lim, kPositive))
+    single.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.mass()); });
+  if (const auto& lim = cuts.pt_sum; active(lim, kPositive))
+    sum.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.pt()); });
+  if (const auto& lim = cuts.eta_sum; active(lim))
+    sum.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.eta()); });
+  if (const auto& lim = cuts.energy_sum; active(lim, kPositive))
+    sum.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.energy()); });
+  if (const auto& lim = cuts.mass_sum; active(lim, kPositive))
+    sum.emplace_back([lim](const Momentum& mom) { return lim.contains(mom.mass()); });
+  if (const auto& lim = cuts.pt_diff; active(lim, kPositive))
+    pair.emplace_back(
+        [lim](const Momentum& mom1, const Momentum& mom2) { return lim.contains(std::fabs(mom1.pt() - mom2.pt())); });
+  if (const auto& lim = cuts.phi_diff; active(lim, kAngle))
+    pair.emplace_back([lim](const Momentum& mom1, const Momentum& mom2) { return lim.contains(mom1.deltaPhi(mom2)); });
+  if (const auto& lim = cuts.rapidity_diff; active(lim, kPositive))
+    pair.emplace_back([lim](const Momentum& mom1, const Momentum& mom2) {
+      return lim.contains(std::fabs(mom1.rapidity() - mom2.rapidity()));
+    });
+}
+
+bool Compiled::System::contain(const std::vector<Momentum>& momenta) const {
+  if (empty())
+    return true;
+  Momentum mom_sum;
+  for (const auto& mom : momenta) {
+    for (const auto& check : single)
+      if (!check(mom))
+        return false;
+    if (!sum.empty())
+      mom_sum += mom;
+  }
+  for (const auto& check : sum)
+    if (!check(mom_sum))
+      return false;
+  if (momenta.size() > 1)
+    for (const auto& check : pair)
+      if (!check(momenta.at(0), momenta.at(1)))
+        return false;
+  return true;
+}
+
+bool Compiled::System::contain(const Momentum& mom) const {
+  for (const auto& check : single)
+    if (!check(mom))
+      return false;
+  for (const auto& check : sum)  // single-particle system
+    if (!check(mom))
+      return false;
+  return true;
+}
@@ -24,6 +24,7 @@
 #include "CepGen/Utils/Timer.h"
 
 using namespace kmr;
+using namespace std::string_literals;
 
 GluonGrid& GluonGrid::get(const cepgen::ParametersList& params) {
   static GluonGrid instance(!params.empty() ? params : description().parameters());
@@ -37,7 +38,9 @@ GluonGrid::GluonGrid(const cepgen::ParametersList& params)
   CG_INFO("GluonGrid") << "Building the KMR grid evaluator.";
 
   cepgen::utils::Timer tmr;
-  {  // file readout part
+  if (isBinary(grid_path_))  // binary grid, mapped into memory
+    load(grid_path_);
+  else {  // file readout part
     std::ifstream file(grid_path_, std::ios::in);
     if (!file.is_open())
       throw CG_FATAL("GluonGrid") << "Failed to load grid file \"" << grid_path_ << "\"!";
@@ -48,6 +51,8 @@ GluonGrid::GluonGrid(const cepgen::ParametersList& params)
     file.close();
     initialise();  // initialise the grid after filling its nodes
   }
+  if (const auto binary_output = steer<std::string>("binaryOutput"); !binary_output.empty())
+    save(binary_output);
   const auto limits = boundaries();
   CG_INFO("GluonGrid") << "KMR grid evaluator built in " << tmr.elapsed() << " s.\n\t"
                        << " log(x)    in range " << limits.at(0) << ",\t"
@@ -64,6 +69,8 @@ double GluonGrid::operator()(double x, double kt2, double mu2) const {
 
 cepgen::ParametersDescription GluonGrid::description() {
   auto desc = cepgen::ParametersDescription();
-  desc.addAs<std::string>("path", DEFAULT_KMR_GRID_PATH);
+  desc.addAs<std::string>("path", DEFAULT_KMR_GRID_PATH)
+      .setDescription("path to the grid file (text, or binary as produced by cepgenGridConverter)");
+  desc.add("binaryOutput", ""s).setDescription("if set, path to a binary grid file to store the grid content into");
   return desc;
 }
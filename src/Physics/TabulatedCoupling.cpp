@@ -0,0 +1,123 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <mutex>
+#include <type_traits>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Modules/CouplingFactory.h"
+#include "CepGen/Physics/Coupling.h"
+#include "CepGen/Utils/CubicStencil.h"
+#include "CepGen/Utils/Limits.h"
+#include "CepGen/Utils/TabulationCache.h"
+
+namespace cepgen {
+  /// Tabulated wrapper for any coupling evolution algorithm
+  /// \note The wrapped algorithm is evaluated once on a regular \f$\log Q\f$ grid, and couplings are retrieved from a
+  ///  cubic (Catmull-Rom) interpolation of this table, without any lock or global state access. Tables are shared
+  ///  among all instances built with identical parameters (e.g. for per-thread process clones). Scales outside the
+  ///  tabulated range are evaluated from the wrapped algorithm, serialised through a mutex.
+  /// \tparam F Coupling evolution algorithms factory
+  template <typename F>
+  class TabulatedCoupling final : public Coupling {
+  public:
+    explicit TabulatedCoupling(const ParametersList& params)
+        : Coupling(params), table_(utils::SharedTabulations<Table>::get(params_.serialise(), *this)) {}
+
+    static ParametersDescription description() {
+      auto desc = Coupling::description();
+      desc.setDescription("Tabulated coupling evolution");
+      const bool strong = std::is_same_v<F, AlphaSFactory>;
+      desc.add("model", F::get().describeParameters(strong ? "pegasus" : "running"))
+          .setDescription("coupling evolution algorithm to tabulate");
+      desc.add("qRange", strong ? Limits{1., 1.e4} : Limits{1.e-3, 1.e4})
+          .setDescription("scale range to tabulate (in GeV)");
+      desc.add("numPoints", 1000).setDescription("number of (log-uniform) tabulation points");
+      desc.add("tolerance", 1.e-6).setDescription("maximal relative interpolation error allowed without warning");
+      return desc;
+    }
+
+    double operator()(double q) const override { return (*table_)(q); }
+
+  private:
+    /// Coupling values on a regular \f$\log Q\f$ grid
+    class Table {
+    public:
+      explicit Table(const TabulatedCoupling& coupling)
+          : model_(F::get().build(coupling.template steer<ParametersList>("model"))),
+            lq_range_(std::log(coupling.template steer<Limits>("qRange").min()),
+                      std::log(coupling.template steer<Limits>("qRange").max())) {
+        if (model_->name() == coupling.name())
+          throw CG_FATAL("TabulatedCoupling") << "Recursive tabulation of couplings is not supported.";
+        const auto num_points = coupling.template steer<int>("numPoints");
+        if (num_points < 4)
+          throw CG_FATAL("TabulatedCoupling") << "At least 4 tabulation points are required, got " << num_points << ".";
+        if (!lq_range_.valid() || coupling.template steer<Limits>("qRange").min() <= 0.)
+          throw CG_FATAL("TabulatedCoupling")
+              << "Invalid tabulation range: Q in " << coupling.template steer<Limits>("qRange") << ".";
+        dlq_ = lq_range_.range() / (num_points - 1);
+        values_.reserve(num_points);
+        for (int i = 0; i < num_points; ++i)
+          values_.emplace_back((*model_)(std::exp(lq_range_.min() + i * dlq_)));
+        // estimate the interpolation accuracy from the cells centres
+        double max_error = 0.;
+        for (int i = 0; i + 1 < num_points; ++i) {
+          const auto lq = lq_range_.min() + (i + 0.5) * dlq_;
+          if (const auto exact = (*model_)(std::exp(lq)); exact != 0. && std::isfinite(exact))
+            max_error = std::max(max_error, std::fabs(interpolate(lq) / exact - 1.));
+        }
+        if (const auto tolerance = coupling.template steer<double>("tolerance"); max_error > tolerance)
+          CG_WARNING("TabulatedCoupling") << "Maximal relative interpolation error for coupling '" << model_->name()
+                                          << "' (" << max_error << ") is above the tolerance (" << tolerance
+                                          << "). Consider increasing the number of tabulation points.";
+        CG_INFO("TabulatedCoupling") << "Coupling '" << model_->name() << "' tabulated on " << num_points
+                                     << " points for Q in " << coupling.template steer<Limits>("qRange") << " GeV.\n\t"
+                                     << "Maximal relative interpolation error: " << max_error << ".";
+      }
+
+      /// Retrieve the coupling value at a given scale
+      inline double operator()(double q) const {
+        if (const auto lq = std::log(q); lq >= lq_range_.min() && lq <= lq_range_.max())
+          return interpolate(lq);
+        const std::lock_guard<std::mutex> lock(model_mutex_);  // out-of-table scale, use the full algorithm
+        return (*model_)(q);
+      }
+
+    private:
+      /// Cubic interpolation of the table for a scale within the tabulated range
+      inline double interpolate(double lq) const {
+        const auto stencil = utils::CubicStencil::regular((lq - lq_range_.min()) / dlq_, values_.size());
+        const auto* val = &values_[stencil.first];
+        return stencil.weights[0] * val[0] + stencil.weights[1] * val[1] + stencil.weights[2] * val[2] +
+               stencil.weights[3] * val[3];
+      }
+
+      const std::unique_ptr<Coupling> model_;  ///< Wrapped algorithm, used outside the tabulated range
+      mutable std::mutex model_mutex_;         ///< Serialise all calls to the wrapped algorithm
+      const Limits lq_range_;                  ///< Tabulated \f$\log Q\f$ range
+      double dlq_{0.};                         ///< Tabulation step in \f$\log Q\f$
+      std::vector<double> values_;             ///< Tabulated coupling values
+    };
+    std::shared_ptr<const Table> table_;  ///< Tabulated values (possibly shared with other instances)
+  };
+}  // namespace cepgen
+using TabulatedAlphaEM = cepgen::TabulatedCoupling<cepgen::AlphaEMFactory>;
+using TabulatedAlphaS = cepgen::TabulatedCoupling<cepgen::AlphaSFactory>;
+REGISTER_ALPHAEM_MODULE("tabulated", TabulatedAlphaEM);
+REGISTER_ALPHAS_MODULE("tabulated", TabulatedAlphaS);
@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <iomanip>
 
 #include "CepGen/Core/Exception.h"
@@ -110,17 +111,19 @@ Momentum& Process::q2() { return event().oneWithRole(Particle::Role::Parton2).mo
 const Momentum& Process::q2() const { return event().oneWithRole(Particle::Role::Parton2).momentum(); }
 
 Momentum& Process::pc(size_t i) {
-  if (event()[Particle::Role::CentralSystem].size() <= i)
+  auto& central_system = event().map()[Particle::Role::CentralSystem];
+  if (central_system.size() <= i)
     throw CG_FATAL("Process:pc") << "Trying to retrieve central particle #" << i << " while only "
-                                 << event()[Particle::Role::CentralSystem].size() << " is/are registered.";
-  return event()[Particle::Role::CentralSystem].at(i).get().momentum();
+                                 << central_system.size() << " is/are registered.";
+  return central_system[i].momentum();
 }
 
 const Momentum& Process::pc(size_t i) const {
-  if (event()(Particle::Role::CentralSystem).size() <= i)
+  const auto& central_system = event()(Particle::Role::CentralSystem);
+  if (central_system.size() <= i)
     throw CG_FATAL("Process:pc") << "Trying to retrieve central particle #" << i << " while only "
-                                 << event()(Particle::Role::CentralSystem).size() << " is/are registered.";
-  return event()(Particle::Role::CentralSystem).at(i).momentum();
+                                 << central_system.size() << " is/are registered.";
+  return central_system[i].momentum();
 }
 
 double Process::shat() const { return (q1() + q2()).mass2(); }
@@ -263,6 +266,16 @@ double Process::weight(const std::vector<double>& x) {
   return (base_jacobian_ * aux_jacobian) * me_integrand * constants::GEVM2_TO_PB;
 }
 
+void Process::weightBatch(size_t num_points, const double* coordinates, double* weights) {
+  const auto num_dimensions = ndim();
+  std::vector<double> coord(num_dimensions);
+  for (size_t i = 0; i < num_points; ++i) {
+    std::copy(coordinates + i * num_dimensions, coordinates + (i + 1) * num_dimensions, coord.begin());
+    clearEvent();
+    weights[i] = weight(coord);
+  }
+}
+
 void Process::clearEvent() {
   if (event_)
     event_->restore();
@@ -18,6 +18,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <array>
 #include <cmath>
 #include <fstream>
 
@@ -54,46 +55,60 @@ namespace cepgen::strfun {
       for (const auto& resonance : steer<std::vector<ParametersList> >("resonances"))
         resonances_.emplace_back(resonance);
       {  // build the FT and F2 grid
+        // Q^2 range used to build the grid, stored alongside (and checked against) its binary version
+        const std::array<double, 2> q2_grid_range{q2_grid_range_.min(), q2_grid_range_.max()};
+        const std::string metadata(reinterpret_cast<const char*>(q2_grid_range.data()), sizeof(q2_grid_range));
         if (!utils::fileExists(sfs_grid_file_))
           throw CG_FATAL("KulaginBarinov")
               << "Failed to load the DIS structure functions interpolation grid from '" << sfs_grid_file_ << "'!";
-        CG_INFO("KulaginBarinov") << "Loading A08 structure function values from '" << sfs_grid_file_ << "' file.";
-        std::ifstream grid_file(sfs_grid_file_);
-        static constexpr size_t num_xbj = 99, num_q2 = 70, num_sf = 2;
-        static constexpr double min_xbj = 1.01e-5;
-        //--- xbj & Q2 binning
-        constexpr size_t num_bins_xbj = num_xbj / 2;
-        const double x1 = 0.3, log_x1 = std::log(x1), delta_x = (log_x1 - std::log(min_xbj)) / (num_bins_xbj - 1),
-                     delta_x1 = std::pow(1. - x1, 2) / (num_bins_xbj + 1);
-        const double deltas =
-            (std::log(std::log(q2_grid_range_.max() / 0.04)) - std::log(std::log(q2_grid_range_.min() / 0.04))) /
-            (num_q2 - 1);
-        // parameterisation of Twist-4 correction from A08 analysis arXiv:0710.0124 [hep-ph] (assuming F2ht=FTht)
-        auto sf_higher_twist = [](double xbj, double q2) -> double {
-          return (std::pow(xbj, 0.9) * std::pow(1. - xbj, 3.63) * (xbj - 0.356) *
-                  (1.0974 + 47.7352 * std::pow(xbj, 4))) /
-                 q2;
-        };
+        if (sfs_grid_.isBinary(sfs_grid_file_)) {  // binary grid, mapped into memory
+          CG_INFO("KulaginBarinov") << "Loading A08 structure function values from '" << sfs_grid_file_
+                                    << "' binary grid.";
+          if (sfs_grid_.load(sfs_grid_file_) != metadata)
+            throw CG_FATAL("KulaginBarinov") << "Binary grid file '" << sfs_grid_file_
+                                             << "' was not built for the steered Q^2 grid range " << q2_grid_range_
+                                             << "!";
+        } else {
+          CG_INFO("KulaginBarinov") << "Loading A08 structure function values from '" << sfs_grid_file_ << "' file.";
+          std::ifstream grid_file(sfs_grid_file_);
+          static constexpr size_t num_xbj = 99, num_q2 = 70, num_sf = 2;
+          static constexpr double min_xbj = 1.01e-5;
+          //--- xbj & Q2 binning
+          constexpr size_t num_bins_xbj = num_xbj / 2;
+          const double x1 = 0.3, log_x1 = std::log(x1), delta_x = (log_x1 - std::log(min_xbj)) / (num_bins_xbj - 1),
+                       delta_x1 = std::pow(1. - x1, 2) / (num_bins_xbj + 1);
+          const double deltas =
+              (std::log(std::log(q2_grid_range_.max() / 0.04)) - std::log(std::log(q2_grid_range_.min() / 0.04))) /
+              (num_q2 - 1);
+          // parameterisation of Twist-4 correction from A08 analysis arXiv:0710.0124 [hep-ph] (assuming F2ht=FTht)
+          auto sf_higher_twist = [](double xbj, double q2) -> double {
+            return (std::pow(xbj, 0.9) * std::pow(1. - xbj, 3.63) * (xbj - 0.356) *
+                    (1.0974 + 47.7352 * std::pow(xbj, 4))) /
+                   q2;
+          };
 
-        for (size_t idx_xbj = 0; idx_xbj < num_xbj; ++idx_xbj) {  // xbj grid
-          const double xbj =
-              idx_xbj < num_bins_xbj
-                  ? std::exp(log(min_xbj) + delta_x * idx_xbj)
-                  : 1. - std::sqrt(std::fabs(std::pow(1. - x1, 2) - delta_x1 * (idx_xbj - num_bins_xbj + 1)));
-          for (size_t idx_q2 = 0; idx_q2 < num_q2; ++idx_q2) {  // Q^2 grid
-            const double q2 =
-                0.04 * std::exp(std::exp(std::log(std::log(q2_grid_range_.min() / 0.04)) + deltas * idx_q2));
-            std::array<double, num_sf> sfs{};
-            for (size_t idx_sf = 0; idx_sf < num_sf; ++idx_sf) {
-              grid_file >> sfs[idx_sf];  // FT, F2
-              sfs[idx_sf] += sf_higher_twist(xbj, q2);
+          for (size_t idx_xbj = 0; idx_xbj < num_xbj; ++idx_xbj) {  // xbj grid
+            const double xbj =
+                idx_xbj < num_bins_xbj
+                    ? std::exp(log(min_xbj) + delta_x * idx_xbj)
+                    : 1. - std::sqrt(std::fabs(std::pow(1. - x1, 2) - delta_x1 * (idx_xbj - num_bins_xbj + 1)));
+            for (size_t idx_q2 = 0; idx_q2 < num_q2; ++idx_q2) {  // Q^2 grid
+              const double q2 =
+                  0.04 * std::exp(std::exp(std::log(std::log(q2_grid_range_.min() / 0.04)) + deltas * idx_q2));
+              std::array<double, num_sf> sfs{};
+              for (size_t idx_sf = 0; idx_sf < num_sf; ++idx_sf) {
+                grid_file >> sfs[idx_sf];  // FT, F2
+                sfs[idx_sf] += sf_higher_twist(xbj, q2);
+              }
+              CG_DEBUG("KulaginBarinov:grid") << "Inserting new values into grid: " << std::vector{xbj, q2} << "("
+                                              << std::vector{idx_xbj, idx_q2} << "): " << sfs;
+              sfs_grid_.insert({xbj, q2}, sfs);
             }
-            CG_DEBUG("KulaginBarinov:grid") << "Inserting new values into grid: " << std::vector{xbj, q2} << "("
-                                            << std::vector{idx_xbj, idx_q2} << "): " << sfs;
-            sfs_grid_.insert({xbj, q2}, sfs);
           }
+          sfs_grid_.initialise();
         }
-        sfs_grid_.initialise();
+        if (const auto binary_output = steer<std::string>("binaryOutput"); !binary_output.empty())
+          sfs_grid_.save(binary_output, metadata);
         CG_DEBUG("KulaginBarinov:grid") << "Grid boundaries: " << sfs_grid_.boundaries();
       }
     }
@@ -158,7 +173,8 @@ namespace cepgen::strfun {
       desc.add("t0", 2.);
       desc.add("Q2range", Limits{1.e-12, 1.e3});
       desc.add("Q2gridRange", Limits{0.8, 1.e3}).setDescription("Q^2 range covered by the grid");
-      desc.add("gridFile", "a08tmc.dat"s).setDescription("path to the DIS grid");
+      desc.add("gridFile", "a08tmc.dat"s).setDescription("path to the DIS grid (text, or binary)");
+      desc.add("binaryOutput", ""s).setDescription("if set, path to a binary grid file to store the grid content into");
       return desc;
     }
 
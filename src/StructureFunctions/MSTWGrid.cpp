@@ -17,6 +17,7 @@
  */
 
 #include <cmath>
+#include <cstring>
 #include <fstream>
 
 #include "CepGen/Core/Exception.h"
@@ -35,20 +36,19 @@ namespace mstw {
   public:
     explicit Grid(const cepgen::ParametersList& params)
         : Parameterisation(params), GridHandler(cepgen::GridType::logarithmic) {
-      {  // file readout part
-        const auto& grid_path = steerPath("gridPath");
+      if (const auto& grid_path = steerPath("gridPath"); isBinary(grid_path)) {  // binary grid, mapped into memory
+        const auto metadata = load(grid_path);
+        if (metadata.size() != sizeof(header_t))
+          throw CG_FATAL("MSTW") << "Binary grid file \"" << grid_path << "\" does not hold a valid MSTW header!";
+        std::memcpy(&header_, metadata.data(), sizeof(header_t));
+        checkHeader();
+      } else {  // file readout part
         std::ifstream file(grid_path, std::ios::binary | std::ios::in);
         if (!file.is_open())
           throw CG_FATAL("MSTW") << "Failed to load grid file \"" << grid_path << "\"!";
 
         file.read(reinterpret_cast<char*>(&header_), sizeof(header_t));
-
-        // first checks on the file header
-        if (header_.magic != GOOD_MAGIC)
-          throw CG_FATAL("MSTW") << "Wrong magic number retrieved: " << header_.magic << ", expecting " << GOOD_MAGIC
-                                 << ".";
-        if (header_.nucleon != header_t::proton)
-          throw CG_FATAL("MSTW") << "Only proton structure function grids can be retrieved for this purpose!";
+        checkHeader();  // first checks on the file header
 
         // retrieve all points and evaluate grid boundaries
         values_t val{};
@@ -57,6 +57,8 @@ namespace mstw {
         file.close();
         initialise();  // initialise the grid after filling its nodes
       }
+      if (const auto binary_output = steer<std::string>("binaryOutput"); !binary_output.empty())
+        save(binary_output, std::string(reinterpret_cast<const char*>(&header_), sizeof(header_t)));
       const auto& bounds = boundaries();
       CG_DEBUG("MSTW") << "MSTW@" << header_.order << " grid evaluator built "
                        << "for " << header_.nucleon << " structure functions (" << header_.cl << ")\n\t"
@@ -68,7 +70,9 @@ namespace mstw {
     static cepgen::ParametersDescription description() {
       auto desc = Parameterisation::description();
       desc.setDescription("MSTW grid (perturbative)");
-      desc.add("gridPath", "mstw_sf_scan_nnlo.dat"s).setDescription("Path to the MSTW grid content");
+      desc.add("gridPath", "mstw_sf_scan_nnlo.dat"s)
+          .setDescription("Path to the MSTW grid content (MSTW scan, or binary as produced by cepgenGridConverter)");
+      desc.add("binaryOutput", ""s).setDescription("if set, path to a binary grid file to store the grid content into");
       return desc;
     }
 
@@ -103,6 +107,15 @@ namespace mstw {
   private:
     static constexpr unsigned int GOOD_MAGIC = 0x5754534d;  // MSTW in ASCII
 
+    /// Ensure the grid header is compatible with this evaluator
+    void checkHeader() const {
+      if (header_.magic != GOOD_MAGIC)
+        throw CG_FATAL("MSTW") << "Wrong magic number retrieved: " << header_.magic << ", expecting " << GOOD_MAGIC
+                               << ".";
+      if (header_.nucleon != header_t::proton)
+        throw CG_FATAL("MSTW") << "Only proton structure function grids can be retrieved for this purpose!";
+    }
+
     header_t header_ = {};
   };
 
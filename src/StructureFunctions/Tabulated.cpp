@@ -0,0 +1,173 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <cmath>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/CubicStencil.h"
+#include "CepGen/Utils/Limits.h"
+#include "CepGen/Utils/TabulationCache.h"
+
+namespace cepgen::strfun {
+  /// Tabulated wrapper for any structure functions parameterisation
+  /// \note The wrapped parameterisation is sampled once on a regular \f$(\log x_{\rm Bj},\log Q^2)\f$ grid, and
+  ///  structure functions are retrieved from a bicubic (Catmull-Rom) interpolation of this table. Points outside the
+  ///  tabulated range are evaluated from the wrapped parameterisation. Tables are shared among all instances built
+  ///  with identical parameters (e.g. for multi-threaded runs).
+  class Tabulated final : public Parameterisation {
+  public:
+    explicit Tabulated(const ParametersList& params)
+        : Parameterisation(params), model_(StructureFunctionsFactory::get().build(steer<ParametersList>("model"))) {
+      if (model_->name() == name())
+        throw CG_FATAL("Tabulated") << "Recursive tabulation of structure functions is not supported.";
+      table_ = utils::SharedTabulations<const Table>::get(params_.serialise(), *this);
+    }
+
+    static ParametersDescription description() {
+      auto desc = Parameterisation::description();
+      desc.setDescription("Tabulated structure functions");
+      desc.add("model", StructureFunctionsFactory::get().describeParameters("LUXLike"))
+          .setDescription("structure functions parameterisation to tabulate");
+      desc.add("xbjRange", Limits{1.e-6, 0.99}).setDescription("Bjorken-x range to tabulate");
+      desc.add("Q2range", Limits{1.e-3, 1.e4}).setDescription("Q^2 range to tabulate (in GeV^2)");
+      desc.add("numXbjPoints", 250).setDescription("number of (log-uniform) tabulation points in Bjorken-x");
+      desc.add("numQ2Points", 250).setDescription("number of (log-uniform) tabulation points in Q^2");
+      return desc;
+    }
+
+    bool hasW1W2() const override { return model_->hasW1W2(); }
+
+    void eval() override {
+      const auto lx = std::log(args_.xbj), lq2 = std::log(args_.q2);
+      if (!table_->contains(lx, lq2)) {  // out-of-table point, use the full parameterisation
+        setF2(model_->F2(args_.xbj, args_.q2));
+        setFL(model_->FL(args_.xbj, args_.q2));
+        if (model_->hasW1W2()) {
+          setW1(model_->W1(args_.xbj, args_.q2));
+          setW2(model_->W2(args_.xbj, args_.q2));
+        }
+        return;
+      }
+      const auto stencil = table_->stencil(lx, lq2);
+      setF2(table_->interpolate(Table::F2, stencil));
+      setFL(table_->interpolate(Table::FL, stencil));
+      if (table_->hasW1W2()) {
+        setW1(table_->interpolate(Table::W1, stencil));
+        setW2(table_->interpolate(Table::W2, stencil));
+      }
+    }
+
+  private:
+    /// Grid of structure functions values, regular in \f$(\log x_{\rm Bj},\log Q^2)\f$
+    class Table {
+    public:
+      enum Quantity { F2 = 0, FL, W1, W2, NUM_QUANTITIES };
+      /// Interpolation stencil for one point (4x4 surrounding nodes and their weights)
+      struct Stencil {
+        utils::CubicStencil x, q2;  ///< Interpolation nodes and weights along each axis
+      };
+
+      explicit Table(const Tabulated& sf)
+          : lx_range_(std::log(sf.steer<Limits>("xbjRange").min()), std::log(sf.steer<Limits>("xbjRange").max())),
+            lq2_range_(std::log(sf.steer<Limits>("Q2range").min()), std::log(sf.steer<Limits>("Q2range").max())),
+            num_x_(sf.steer<int>("numXbjPoints")),
+            num_q2_(sf.steer<int>("numQ2Points")),
+            has_w1w2_(sf.model_->hasW1W2()) {
+        if (num_x_ < 4 || num_q2_ < 4)
+          throw CG_FATAL("Tabulated") << "At least 4 tabulation points are required along each axis, got " << num_x_
+                                      << "x" << num_q2_ << ".";
+        if (!lx_range_.valid() || !lq2_range_.valid() || lx_range_.max() >= 0.)
+          throw CG_FATAL("Tabulated") << "Invalid tabulation range: xBj in " << sf.steer<Limits>("xbjRange")
+                                      << ", Q^2 in " << sf.steer<Limits>("Q2range") << ".";
+        dlx_ = lx_range_.range() / (num_x_ - 1);
+        dlq2_ = lq2_range_.range() / (num_q2_ - 1);
+        values_.resize(NUM_QUANTITIES * num_x_ * num_q2_, 0.);
+        for (size_t i = 0; i < num_x_; ++i)
+          for (size_t j = 0; j < num_q2_; ++j) {
+            const auto xbj = std::exp(lx_range_.min() + i * dlx_), q2 = std::exp(lq2_range_.min() + j * dlq2_);
+            const auto values = evaluate(*sf.model_, xbj, q2);
+            for (size_t k = 0; k < NUM_QUANTITIES; ++k)
+              values_[index(k, i, j)] = values[k];
+          }
+        // estimate the interpolation accuracy from the cells centres
+        double max_error = 0.;
+        for (size_t i = 0; i + 1 < num_x_; ++i)
+          for (size_t j = 0; j + 1 < num_q2_; ++j) {
+            const auto lx = lx_range_.min() + (i + 0.5) * dlx_, lq2 = lq2_range_.min() + (j + 0.5) * dlq2_;
+            const auto exact_f2 = evaluate(*sf.model_, std::exp(lx), std::exp(lq2))[F2];
+            if (exact_f2 != 0.)
+              max_error = std::max(max_error, std::fabs(interpolate(F2, stencil(lx, lq2)) / exact_f2 - 1.));
+          }
+        CG_INFO("Tabulated") << "Structure functions '" << sf.model_->name() << "' tabulated on a " << num_x_ << "x"
+                             << num_q2_ << " (log xBj, log Q^2) grid for xBj in " << sf.steer<Limits>("xbjRange")
+                             << " and Q^2 in " << sf.steer<Limits>("Q2range") << " GeV^2.\n\t"
+                             << "Maximal relative interpolation error on F2: " << max_error << ".";
+      }
+
+      inline bool hasW1W2() const { return has_w1w2_; }
+      /// Is the point within the tabulated range?
+      inline bool contains(double lx, double lq2) const {
+        return lx >= lx_range_.min() && lx <= lx_range_.max() && lq2 >= lq2_range_.min() && lq2 <= lq2_range_.max();
+      }
+      /// Compute the interpolation stencil for a point within the tabulated range
+      inline Stencil stencil(double lx, double lq2) const {
+        return Stencil{utils::CubicStencil::regular((lx - lx_range_.min()) / dlx_, num_x_),
+                       utils::CubicStencil::regular((lq2 - lq2_range_.min()) / dlq2_, num_q2_)};
+      }
+      /// Bicubic interpolation of one quantity
+      inline double interpolate(size_t quantity, const Stencil& stencil) const {
+        double out = 0.;
+        const auto &wx = stencil.x.weights, &wq2 = stencil.q2.weights;
+        for (size_t i = 0; i < 4; ++i) {
+          const auto* row = &values_[index(quantity, stencil.x.first + i, stencil.q2.first)];
+          out += wx[i] * (wq2[0] * row[0] + wq2[1] * row[1] + wq2[2] * row[2] + wq2[3] * row[3]);
+        }
+        return out;
+      }
+
+    private:
+      /// Index of a node in the flat values array
+      inline size_t index(size_t quantity, size_t ix, size_t iq2) const {
+        return (quantity * num_x_ + ix) * num_q2_ + iq2;
+      }
+      /// Evaluate all quantities from the wrapped parameterisation
+      static std::array<double, NUM_QUANTITIES> evaluate(Parameterisation& sf, double xbj, double q2) {
+        std::array<double, NUM_QUANTITIES> out{
+            sf.F2(xbj, q2), sf.FL(xbj, q2), sf.hasW1W2() ? sf.W1(xbj, q2) : 0., sf.hasW1W2() ? sf.W2(xbj, q2) : 0.};
+        for (auto& value : out)
+          if (!std::isfinite(value))
+            value = 0.;
+        return out;
+      }
+
+      const Limits lx_range_, lq2_range_;
+      const size_t num_x_, num_q2_;
+      const bool has_w1w2_;
+      double dlx_{0.}, dlq2_{0.};
+      std::vector<double> values_;  ///< Flat array of tabulated values (quantity, xBj, Q^2)
+    };
+
+    const std::unique_ptr<Parameterisation> model_;  ///< Wrapped parameterisation, used outside the tabulated range
+    std::shared_ptr<const Table> table_;             ///< Tabulated values (possibly shared with other instances)
+  };
+}  // namespace cepgen::strfun
+using cepgen::strfun::Tabulated;
+REGISTER_STRFUN("Tabulated", 501, Tabulated);
@@ -0,0 +1,373 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+#include "CepGen/Utils/MappedFile.h"
+
+using namespace cepgen::utils;
+
+namespace {
+  constexpr size_t MAX_KEYS = cepgen::Event::EventMetadata::MAX_KEYS;
+  static_assert(MAX_KEYS <= 32, "Metadata keys bitmasks are stored as 32-bit words.");
+
+  /// Total size of a collection of columns, in bytes
+  template <typename... T>
+  size_t columnsSize(const std::vector<T>&... columns) {
+    return ((columns.size() * sizeof(T)) + ...);
+  }
+  /// Write a collection of columns into a binary stream
+  template <typename... T>
+  void writeColumns(std::ofstream& file, const std::vector<T>&... columns) {
+    (file.write(reinterpret_cast<const char*>(columns.data()), columns.size() * sizeof(T)), ...);
+  }
+  template <typename T>
+  void writeObject(std::ofstream& file, const T& object) {
+    file.write(reinterpret_cast<const char*>(&object), sizeof(T));
+  }
+}  // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+BinaryEventWriter::BinaryEventWriter(const std::string& path, size_t chunk_size)
+    : path_(path), chunk_size_(std::max<size_t>(chunk_size, 1)), file_(path, std::ios::binary | std::ios::trunc) {
+  if (!file_.is_open())
+    throw CG_FATAL("BinaryEventWriter") << "Failed to open output file '" << path_ << "' for writing.";
+  writeObject(file_, binary_event::FileHeader{{'C', 'G', 'E', 'V', 'E', 'N', 'T', '\0'}, binary_event::VERSION, 0});
+  chunk_.clear();
+}
+
+BinaryEventWriter::~BinaryEventWriter() {
+  try {  // never throw from a destructor
+    if (!finalise())
+      CG_WARNING("BinaryEventWriter") << "Failed to finalise the binary events file '" << path_ << "'. "
+                                      << "Its complete chunks may still be recovered by the reader.";
+  } catch (const std::exception& exc) {
+    CG_WARNING("BinaryEventWriter") << "Failed to finalise the binary events file '" << path_ << "': " << exc.what();
+  }
+}
+
+void BinaryEventWriter::write(const Event& event) {
+  if (!file_.is_open())
+    throw CG_FATAL("BinaryEventWriter") << "Output file '" << path_ << "' is already closed.";
+  uint32_t keys = 0;
+  for (size_t key = 0; key < MAX_KEYS; ++key) {
+    if (event.metadata.has(key))
+      keys |= 1u << key;
+    chunk_.metadata.emplace_back(event.metadata(key));
+  }
+  chunk_.metadata_keys.emplace_back(keys);
+  chunk_.compressed.emplace_back(event.compressed());
+  for (const auto& part : event.particles()) {
+    const auto& mom = part.momentum();
+    chunk_.px.emplace_back(mom.px());
+    chunk_.py.emplace_back(mom.py());
+    chunk_.pz.emplace_back(mom.pz());
+    chunk_.energy.emplace_back(mom.energy());
+    chunk_.pdg_id.emplace_back(part.integerPdgId());
+    chunk_.id.emplace_back(part.id());
+    chunk_.polarisation.emplace_back(part.polarisation());
+    chunk_.status.emplace_back(static_cast<int32_t>(part.status()));
+    chunk_.role.emplace_back(static_cast<int8_t>(part.role()));
+    const auto &mothers = part.mothers(), &children = part.children();
+    chunk_.num_mothers.emplace_back(mothers.size());
+    chunk_.relations.insert(chunk_.relations.end(), mothers.begin(), mothers.end());
+    chunk_.relations.insert(chunk_.relations.end(), children.begin(), children.end());
+    chunk_.first_relation.emplace_back(chunk_.relations.size());
+  }
+  chunk_.first_particle.emplace_back(chunk_.id.size());
+  ++num_events_;
+  if (chunk_.metadata_keys.size() >= chunk_size_ && !flushChunk())
+    throw CG_FATAL("BinaryEventWriter") << "Failed to write a chunk of " << chunk_size_ << " event(s) into file '"
+                                        << path_ << "'.";
+}
+
+bool BinaryEventWriter::flushChunk() {
+  const auto num_events = chunk_.metadata_keys.size();
+  if (num_events == 0)
+    return file_.good();
+  // only keep the metadata columns populated for at least one event of the chunk
+  uint32_t chunk_keys = 0;
+  for (const auto& keys : chunk_.metadata_keys)
+    chunk_keys |= keys;
+  std::vector<float> metadata;
+  metadata.reserve(num_events * std::bitset<MAX_KEYS>(chunk_keys).count());
+  for (size_t i = 0; i < num_events; ++i)
+    for (size_t key = 0; key < MAX_KEYS; ++key)
+      if (chunk_keys & (1u << key))
+        metadata.emplace_back(chunk_.metadata.at(i * MAX_KEYS + key));
+  std::vector<char> keys_table;  // names of the metadata keys populated in this chunk
+  for (size_t key = 0; key < MAX_KEYS; ++key)
+    if (chunk_keys & (1u << key)) {
+      const auto name = Event::EventMetadata::name(key);
+      const auto length = static_cast<uint32_t>(name.size());
+      const auto* length_bytes = reinterpret_cast<const char*>(&length);
+      keys_table.insert(keys_table.end(), length_bytes, length_bytes + sizeof(uint32_t));
+      keys_table.insert(keys_table.end(), name.begin(), name.end());
+    }
+  const auto size = columnsSize(chunk_.px,
+                                chunk_.py,
+                                chunk_.pz,
+                                chunk_.energy,
+                                chunk_.pdg_id,
+                                metadata,
+                                chunk_.first_particle,
+                                chunk_.metadata_keys,
+                                chunk_.id,
+                                chunk_.polarisation,
+                                chunk_.status,
+                                chunk_.first_relation,
+                                chunk_.num_mothers,
+                                chunk_.relations,
+                                chunk_.role,
+                                chunk_.compressed,
+                                keys_table);
+  const auto padding = (8 - size % 8) % 8;  // keep all chunk headers (and their 64-bit columns) aligned
+  index_.emplace_back(binary_event::IndexEntry{static_cast<uint64_t>(file_.tellp()), num_events_ - num_events});
+  writeObject(file_,
+              binary_event::ChunkHeader{{'C', 'H', 'N', 'K'},
+                                        static_cast<uint32_t>(num_events),
+                                        chunk_keys,
+                                        0,
+                                        chunk_.id.size(),
+                                        chunk_.relations.size(),
+                                        size + padding});
+  writeColumns(file_,
+               chunk_.px,
+               chunk_.py,
+               chunk_.pz,
+               chunk_.energy,
+               chunk_.pdg_id,
+               metadata,
+               chunk_.first_particle,
+               chunk_.metadata_keys,
+               chunk_.id,
+               chunk_.polarisation,
+               chunk_.status,
+               chunk_.first_relation,
+               chunk_.num_mothers,
+               chunk_.relations,
+               chunk_.role,
+               chunk_.compressed,
+               keys_table);
+  writeColumns(file_, std::vector<char>(padding, 0));
+  chunk_.clear();
+  return file_.good();
+}
+
+void BinaryEventWriter::close() {
+  if (!finalise())
+    throw CG_FATAL("BinaryEventWriter") << "Failed to finalise the binary events file '" << path_ << "'.";
+}
+
+bool BinaryEventWriter::finalise() {
+  if (!file_.is_open())
+    return true;
+  if (!flushChunk()) {
+    file_.close();
+    return false;
+  }
+  const auto index_offset = static_cast<uint64_t>(file_.tellp());
+  writeColumns(file_, index_);
+  writeObject(file_,
+              binary_event::Trailer{cross_section_,
+                                    cross_section_.uncertainty(),
+                                    num_events_,
+                                    index_.size(),
+                                    index_offset,
+                                    {'C', 'G', 'E', 'V', 'I', 'D', 'X', '\0'}});
+  file_.close();
+  if (file_.fail())
+    return false;
+  CG_DEBUG("BinaryEventWriter") << "Binary events file '" << path_ << "' closed with " << num_events_
+                                << " event(s) in " << index_.size() << " chunk(s).";
+  return true;
+}
+
+void BinaryEventWriter::Chunk::clear() {
+  for (auto* column : {&px, &py, &pz, &energy})
+    column->clear();
+  pdg_id.clear();
+  metadata.clear();
+  first_particle = {0};
+  metadata_keys.clear();
+  id.clear();
+  polarisation.clear();
+  status.clear();
+  first_relation = {0};
+  num_mothers.clear();
+  relations.clear();
+  role.clear();
+  compressed.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+BinaryEventReader::BinaryEventReader(const std::string& path) : file_(new MappedFile(path)) {
+  const auto* data = file_->data();
+  if (file_->size() < sizeof(binary_event::FileHeader))
+    throw CG_FATAL("BinaryEventReader") << "File '" << path << "' is too short to be a binary events file.";
+  binary_event::FileHeader header;
+  std::memcpy(&header, data, sizeof(binary_event::FileHeader));
+  if (std::string(header.magic, 7) != "CGEVENT")
+    throw CG_FATAL("BinaryEventReader") << "File '" << path << "' is not a binary events file.";
+  if (header.version != binary_event::VERSION)
+    throw CG_FATAL("BinaryEventReader") << "Unsupported binary events file version: " << header.version
+                                        << " (expecting " << binary_event::VERSION << ").";
+
+  binary_event::Trailer trailer;
+  if (file_->size() >= sizeof(binary_event::FileHeader) + sizeof(binary_event::Trailer))
+    std::memcpy(&trailer, data + file_->size() - sizeof(binary_event::Trailer), sizeof(binary_event::Trailer));
+  else
+    trailer.magic[0] = '\0';
+  if (std::string(trailer.magic, 7) != "CGEVIDX") {
+    // file was not properly closed; recover all complete chunks from a sequential scan
+    CG_WARNING("BinaryEventReader") << "No chunks index found in file '" << path << "'. "
+                                    << "Recovering its content from a sequential scan.";
+    binary_event::ChunkHeader chunk_header;
+    for (size_t offset = sizeof(binary_event::FileHeader); offset + sizeof(binary_event::ChunkHeader) <= file_->size();
+         offset += sizeof(binary_event::ChunkHeader) + chunk_header.size) {
+      std::memcpy(&chunk_header, data + offset, sizeof(binary_event::ChunkHeader));
+      if (std::string(chunk_header.magic, 4) != "CHNK" ||
+          offset + sizeof(binary_event::ChunkHeader) + chunk_header.size > file_->size())
+        break;
+      parseChunk(offset, num_events_);
+    }
+    return;
+  }
+  cross_section_ = Value{trailer.cross_section, trailer.cross_section_error};
+  if (trailer.index_offset + trailer.num_chunks * sizeof(binary_event::IndexEntry) >
+      file_->size() - sizeof(binary_event::Trailer))
+    throw CG_FATAL("BinaryEventReader") << "Corrupted index in binary events file '" << path << "'.";
+  std::vector<binary_event::IndexEntry> index(trailer.num_chunks);
+  std::memcpy(index.data(), data + trailer.index_offset, trailer.num_chunks * sizeof(binary_event::IndexEntry));
+  for (const auto& entry : index)
+    parseChunk(entry.offset, entry.first_event);
+  if (num_events_ != trailer.num_events)
+    throw CG_FATAL("BinaryEventReader") << "Inconsistent number of events in binary events file '" << path
+                                        << "': index lists " << trailer.num_events << ", chunks contain "
+                                        << num_events_ << ".";
+  CG_DEBUG("BinaryEventReader") << "Binary events file '" << path << "' mapped with " << num_events_
+                                << " event(s) in " << chunks_.size() << " chunk(s).";
+}
+
+BinaryEventReader::~BinaryEventReader() = default;
+
+bool BinaryEventReader::isBinary(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  binary_event::FileHeader header;
+  return file.read(reinterpret_cast<char*>(&header), sizeof(binary_event::FileHeader)) &&
+         std::string(header.magic, 7) == "CGEVENT";
+}
+
+size_t BinaryEventReader::parseChunk(size_t offset, size_t first_event) {
+  const auto* data = file_->data();
+  if (offset % 8 != 0 || offset + sizeof(binary_event::ChunkHeader) > file_->size())
+    throw CG_FATAL("BinaryEventReader") << "Invalid chunk position in binary events file '" << file_->path()
+                                        << "': " << offset << ".";
+  binary_event::ChunkHeader header;
+  std::memcpy(&header, data + offset, sizeof(binary_event::ChunkHeader));
+  if (std::string(header.magic, 4) != "CHNK")
+    throw CG_FATAL("BinaryEventReader") << "Invalid chunk header in binary events file '" << file_->path()
+                                        << "' at position " << offset << ".";
+  offset += sizeof(binary_event::ChunkHeader);
+  const auto end = offset + header.size;
+  if (end > file_->size())
+    throw CG_FATAL("BinaryEventReader") << "Truncated chunk in binary events file '" << file_->path() << "'.";
+  const size_t num_events = header.num_events, num_particles = header.num_particles;
+  // all columns are stored contiguously, by decreasing alignment requirement
+  auto column = [&](auto*& ptr, size_t size) {
+    ptr = reinterpret_cast<std::remove_reference_t<decltype(ptr)>>(data + offset);
+    offset += size * sizeof(*ptr);
+    if (offset > end)
+      throw CG_FATAL("BinaryEventReader") << "Corrupted chunk in binary events file '" << file_->path() << "'.";
+  };
+  Chunk chunk;
+  chunk.first_event = first_event;
+  chunk.num_events = num_events;
+  chunk.metadata_keys = header.metadata_keys;
+  column(chunk.px, num_particles);
+  column(chunk.py, num_particles);
+  column(chunk.pz, num_particles);
+  column(chunk.energy, num_particles);
+  column(chunk.pdg_id, num_particles);
+  column(chunk.metadata, num_events * std::bitset<MAX_KEYS>(header.metadata_keys).count());
+  column(chunk.first_particle, num_events + 1);
+  column(chunk.event_metadata_keys, num_events);
+  column(chunk.id, num_particles);
+  column(chunk.polarisation, num_particles);
+  column(chunk.status, num_particles);
+  column(chunk.first_relation, num_particles + 1);
+  column(chunk.num_mothers, num_particles);
+  column(chunk.relations, header.num_relations);
+  column(chunk.role, num_particles);
+  column(chunk.compressed, num_events);
+  // map the metadata keys names to the process-wide registry
+  chunk.keys.assign(MAX_KEYS, 0);
+  for (size_t key = 0; key < MAX_KEYS; ++key) {
+    if ((header.metadata_keys & (1u << key)) == 0)
+      continue;
+    const char* length_bytes{nullptr};
+    column(length_bytes, sizeof(uint32_t));
+    uint32_t length;
+    std::memcpy(&length, length_bytes, sizeof(uint32_t));
+    const char* name{nullptr};
+    column(name, length);
+    chunk.keys[key] = Event::EventMetadata::key(std::string(name, length));
+  }
+  chunks_.emplace_back(chunk);
+  num_events_ += num_events;
+  return end;
+}
+
+void BinaryEventReader::read(size_t event_index, Event& event) const {
+  if (event_index >= num_events_)
+    throw CG_FATAL("BinaryEventReader") << "Event index " << event_index << " is out of range for file '"
+                                        << file_->path() << "' (" << num_events_ << " event(s)).";
+  const auto before = [](size_t index, const Chunk& chunk) { return index < chunk.first_event; };
+  const auto& chunk = *std::prev(std::upper_bound(chunks_.begin(), chunks_.end(), event_index, before));
+  const auto iev = event_index - chunk.first_event;
+  event = Event(chunk.compressed[iev] != 0);
+  event.metadata.clear();
+  const auto* values = chunk.metadata + iev * std::bitset<MAX_KEYS>(chunk.metadata_keys).count();
+  for (size_t key = 0; key < MAX_KEYS; ++key) {
+    if ((chunk.metadata_keys & (1u << key)) == 0)
+      continue;
+    if (chunk.event_metadata_keys[iev] & (1u << key))
+      event.metadata[chunk.keys[key]] = *values;
+    ++values;
+  }
+  for (auto ip = chunk.first_particle[iev]; ip < chunk.first_particle[iev + 1]; ++ip) {
+    Particle part(static_cast<Particle::Role>(chunk.role[ip]));
+    part.setId(chunk.id[ip])
+        .setIntegerPdgId(chunk.pdg_id[ip])
+        .setStatus(chunk.status[ip])
+        .setMomentum(Momentum::fromPxPyPzE(chunk.px[ip], chunk.py[ip], chunk.pz[ip], chunk.energy[ip]), true);
+    if (chunk.polarisation[ip] != 0.f)
+      part.setPolarisation(chunk.polarisation[ip]);
+    const auto *relations = chunk.relations + chunk.first_relation[ip], *children = relations + chunk.num_mothers[ip];
+    part.mothers() = ParticlesIds(relations, children);
+    part.children() = ParticlesIds(children, chunk.relations + chunk.first_relation[ip + 1]);
+    event.addParticle(part);
+  }
+}
@@ -19,38 +19,35 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_math.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
 #include <limits>
 
 #include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/CubicStencil.h"
 #include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/MappedFile.h"
 
 //#define GRID_HANDLER_DEBUG 1
 
 using namespace cepgen;
 
 template <size_t D, size_t N>
-GridHandler<D, N>::GridHandler(const GridType& grid_type) : grid_type_(grid_type) {
+GridHandler<D, N>::GridHandler(const GridType& grid_type, const GridInterpolation& interpolation)
+    : grid_type_(grid_type), interpolation_(interpolation) {
   for (size_t i = 0; i < D; ++i)
     accelerators_.emplace_back(gsl_interp_accel_alloc(), gsl_interp_accel_free);
 }
 
 template <size_t D, size_t N>
-typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_coords) const {
+typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const point_t& in_coords) const {
   if (!initialised_)
     throw CG_FATAL("GridHandler") << "Grid extrapolator called but not initialised!";
 
   values_t out{};
-  coord_t coord = in_coords;
-  switch (grid_type_) {
-    case GridType::logarithmic: {
-      std::transform(coord.begin(), coord.end(), coord.begin(), [](const auto& c) { return log10(c); });
-    } break;
-    case GridType::square: {
-      std::transform(coord.begin(), coord.end(), coord.begin(), [](const auto& c) { return c * c; });
-    } break;
-    default:
-      break;
-  }
+  const auto coord = transform(in_coords);
   switch (D) {  // dimension of the vector space coordinate to evaluate
     case 1: {
       for (size_t i = 0; i < N; ++i) {
@@ -64,8 +61,8 @@ typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_c
         }
       }
     } break;
-    case 2: {
 #ifdef GSL_VERSION_ABOVE_2_1
+    case 2: {
       const double x = coord.at(0), y = coord.at(1);
       for (size_t i = 0; i < N; ++i) {
         if (const auto res = gsl_spline2d_eval_e(
@@ -77,55 +74,23 @@ typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(const coord_t& in_c
                                     << ". GSL error: " << gsl_strerror(res);
         }
       }
-#else
-      //--- retrieve the indices of the bin in the set
-      coord_t before(D), after(D);
-      findIndices(coord, before, after);
-      //--- find boundaries values
-      const gridpoint_t &ext_11 = values_raw_.at({before[0], before[1]}),
-                        &ext_12 = values_raw_.at({before[0], after[1]}),
-                        &ext_21 = values_raw_.at({after[0], before[1]}), &ext_22 = values_raw_.at({after[0], after[1]});
-      //--- now that we have the boundaries, we may interpolate
-      coord_t c_d(D);
-      for (size_t i = 0; i < D; ++i)
-        c_d[i] = (after[i] != before[i]) ? (coord.at(i) - before[i]) / (after[i] - before[i]) : 0.;
-      const gridpoint_t ext_1 = ext_11 * (1. - c_d[0]) + ext_21 * c_d[0];
-      const gridpoint_t ext_2 = ext_12 * (1. - c_d[0]) + ext_22 * c_d[0];
-      out = ext_1 * (1. - c_d[1]) + ext_2 * c_d[1];
-#endif
-    } break;
-    case 3: {
-      // retrieve the indices of the bin in the set
-      coord_t before(D), after(D);
-      findIndices(coord, before, after);
-      // find boundaries values
-      const grid_point_t &ext_111 = values_raw_.at({before[0], before[1], before[2]}),
-                         &ext_112 = values_raw_.at({before[0], before[1], after[2]}),
-                         &ext_121 = values_raw_.at({before[0], after[1], before[2]}),
-                         &ext_122 = values_raw_.at({before[0], after[1], after[2]}),
-                         &ext_211 = values_raw_.at({after[0], before[1], before[2]}),
-                         &ext_212 = values_raw_.at({after[0], before[1], after[2]}),
-                         &ext_221 = values_raw_.at({after[0], after[1], before[2]}),
-                         &ext_222 = values_raw_.at({after[0], after[1], after[2]});
-      // now that we have the boundaries, we may interpolate
-      coord_t c_d(D);
-      for (size_t i = 0; i < D; ++i)
-        c_d[i] = (after[i] != before[i]) ? (coord.at(i) - before[i]) / (after[i] - before[i]) : 0.;
-      const grid_point_t ext_11 = ext_111 * (1. - c_d[0]) + ext_211 * c_d[0];
-      const grid_point_t ext_12 = ext_112 * (1. - c_d[0]) + ext_212 * c_d[0];
-      const grid_point_t ext_21 = ext_121 * (1. - c_d[0]) + ext_221 * c_d[0];
-      const grid_point_t ext_22 = ext_122 * (1. - c_d[0]) + ext_222 * c_d[0];
-      const grid_point_t ext_1 = ext_11 * (1. - c_d[1]) + ext_21 * c_d[1];
-      const grid_point_t ext_2 = ext_12 * (1. - c_d[1]) + ext_22 * c_d[1];
-      out = ext_1 * (1. - c_d[2]) + ext_2 * c_d[2];
     } break;
-    default:
-      throw CG_FATAL("GridHandler") << "Unsupported number of dimensions: " << N << ".\n\t"
-                                    << "Please contact the developers to add such a new feature.";
+#endif
+    default:  // interpolation from the dense grid storage
+      out = evalDense(coord);
+      break;
   }
   return out;
 }
 
+template <size_t D, size_t N>
+void GridHandler<D, N>::eval(const std::vector<point_t>& in_coords, std::vector<values_t>& out) const {
+  if (!initialised_)
+    throw CG_FATAL("GridHandler") << "Grid extrapolator called but not initialised!";
+  out.resize(in_coords.size());
+  std::transform(in_coords.begin(), in_coords.end(), out.begin(), [this](const auto& coord) { return eval(coord); });
+}
+
 template <size_t D, size_t N>
 void GridHandler<D, N>::insert(const coord_t& coord, values_t value) {
   auto modified_coordinate = coord;
@@ -151,20 +116,171 @@ template <size_t D, size_t N>
 void GridHandler<D, N>::initialise() {
   if (values_raw_.empty())
     throw CG_ERROR("GridHandler") << "Empty grid.";
-  gsl_set_error_handler_off();
   //--- start by building grid coordinates from raw values
   for (auto& coordinate : coordinates_)
     coordinate.clear();
   for (const auto& val : values_raw_) {
-    unsigned short i = 0;
-    for (const auto& c : val.first) {
-      if (std::find(coordinates_.at(i).begin(), coordinates_.at(i).end(), c) == coordinates_.at(i).end())
-        coordinates_.at(i).emplace_back(c);
-      ++i;
-    }
+    if (val.first.size() != D)
+      throw CG_FATAL("GridHandler") << "Invalid coordinate dimension for x=" << val.first << ": expected " << D
+                                    << ", got " << val.first.size() << ".";
+    for (size_t i = 0; i < D; ++i)
+      coordinates_[i].emplace_back(val.first[i]);
   }
-  for (auto& c : coordinates_)
+  for (auto& c : coordinates_) {
     std::sort(c.begin(), c.end());
+    c.erase(std::unique(c.begin(), c.end()), c.end());
+  }
+  //--- build the dense storage from the raw values
+  setupAxes();
+  grid_.assign(N * num_nodes_, std::numeric_limits<double>::quiet_NaN());
+  for (const auto& [coordinate, value] : values_raw_) {
+    size_t offset = 0;
+    for (size_t i = 0; i < D; ++i) {
+      const auto& coord_i = coordinates_[i];
+      offset +=
+          strides_[i] * std::distance(coord_i.begin(), std::lower_bound(coord_i.begin(), coord_i.end(), coordinate[i]));
+    }
+    for (size_t i = 0; i < N; ++i)
+      grid_[i * num_nodes_ + offset] = value[i];
+  }
+  if (const auto num_missing = std::count_if(grid_.begin(), grid_.end(), [](double val) { return std::isnan(val); });
+      num_missing > 0) {
+    CG_WARNING("GridHandler") << "Grid is not fully populated: " << num_missing / N << " node(s) out of " << num_nodes_
+                              << " are missing. Their values are set to zero.";
+    std::replace_if(grid_.begin(), grid_.end(), [](double val) { return std::isnan(val); }, 0.);
+  }
+  mapping_.reset();
+  values_data_ = grid_.data();
+  initialiseInterpolators();
+}
+
+template <size_t D, size_t N>
+void GridHandler<D, N>::save(const std::string& path, const std::string& metadata) const {
+  if (!initialised_)
+    throw CG_FATAL("GridHandler") << "Grid must be initialised before being stored into a file.";
+  std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+  if (!file.is_open())
+    throw CG_FATAL("GridHandler") << "Failed to open file '" << path << "' for writing.";
+  const BinaryHeader header{
+      {'C', 'G', 'I', 'G', 'R', 'I', 'D', '\0'}, BINARY_VERSION, D, N, static_cast<uint32_t>(grid_type_)};
+  file.write(reinterpret_cast<const char*>(&header), sizeof(BinaryHeader));
+  for (const auto& coordinate : coordinates_) {
+    const uint64_t num_nodes = coordinate.size();
+    file.write(reinterpret_cast<const char*>(&num_nodes), sizeof(uint64_t));
+  }
+  const uint64_t metadata_size = metadata.size();
+  file.write(reinterpret_cast<const char*>(&metadata_size), sizeof(uint64_t));
+  file.write(metadata.data(), metadata.size());
+  const std::array<char, sizeof(double)> padding{};  // keep the coordinates and values blocks aligned
+  file.write(padding.data(), (sizeof(double) - metadata.size() % sizeof(double)) % sizeof(double));
+  for (const auto& coordinate : coordinates_)
+    file.write(reinterpret_cast<const char*>(coordinate.data()), coordinate.size() * sizeof(double));
+  file.write(reinterpret_cast<const char*>(values_data_), N * num_nodes_ * sizeof(double));
+  if (!file)
+    throw CG_FATAL("GridHandler") << "Failed to write the grid content into '" << path << "'.";
+  CG_INFO("GridHandler") << "Grid with " << num_nodes_ << " nodes stored into binary file '" << path << "'.";
+}
+
+template <size_t D, size_t N>
+std::string GridHandler<D, N>::load(const std::string& path) {
+  auto mapping = std::make_shared<const utils::MappedFile>(path);
+  const auto* data = mapping->data();
+  auto check_size = [&mapping](size_t size) {
+    if (mapping->size() < size)
+      throw CG_FATAL("GridHandler") << "Truncated binary grid file '" << mapping->path() << "': expecting at least "
+                                    << size << " bytes, got " << mapping->size() << ".";
+  };
+  check_size(sizeof(BinaryHeader));
+  BinaryHeader header;
+  std::memcpy(&header, data, sizeof(BinaryHeader));
+  if (std::string(header.magic, 7) != "CGIGRID")
+    throw CG_FATAL("GridHandler") << "File '" << path << "' is not a binary grid file.";
+  if (header.version != BINARY_VERSION)
+    throw CG_FATAL("GridHandler") << "Unsupported binary grid version in '" << path << "': " << header.version
+                                  << " (expecting " << BINARY_VERSION << ").";
+  if (header.dimension != D || header.num_values != N)
+    throw CG_FATAL("GridHandler") << "Invalid grid dimensions in '" << path << "': got a " << header.dimension << "->"
+                                  << header.num_values << " grid, expecting " << D << "->" << N << ".";
+  if (header.grid_type != static_cast<uint32_t>(grid_type_))
+    throw CG_FATAL("GridHandler") << "Invalid grid coordinates type in '" << path << "': " << header.grid_type
+                                  << " (expecting " << static_cast<uint32_t>(grid_type_) << ").";
+  size_t offset = sizeof(BinaryHeader);
+  check_size(offset + D * sizeof(uint64_t));
+  std::array<uint64_t, D> num_nodes;
+  std::memcpy(num_nodes.data(), data + offset, D * sizeof(uint64_t));
+  offset += D * sizeof(uint64_t);
+  check_size(offset + sizeof(uint64_t));
+  uint64_t metadata_size;
+  std::memcpy(&metadata_size, data + offset, sizeof(uint64_t));
+  offset += sizeof(uint64_t);
+  check_size(offset + metadata_size);
+  std::string metadata(data + offset, metadata_size);
+  offset += (metadata_size + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+  for (size_t i = 0; i < D; ++i) {
+    check_size(offset + num_nodes[i] * sizeof(double));
+    const auto* begin = reinterpret_cast<const double*>(data + offset);
+    coordinates_[i].assign(begin, begin + num_nodes[i]);
+    offset += num_nodes[i] * sizeof(double);
+  }
+  setupAxes();
+  check_size(offset + N * num_nodes_ * sizeof(double));
+  values_raw_.clear();
+  grid_.clear();
+  values_data_ = reinterpret_cast<const double*>(data + offset);  // values are read in place from the mapped file
+  mapping_ = mapping;
+  initialiseInterpolators();
+  CG_DEBUG("GridHandler") << "Grid with " << num_nodes_ << " nodes loaded from binary file '" << path << "'.";
+  return metadata;
+}
+
+template <size_t D, size_t N>
+bool GridHandler<D, N>::isBinary(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::in);
+  char magic[8]{};
+  return file.read(magic, sizeof(magic)) && std::string(magic, 7) == "CGIGRID";
+}
+
+template <size_t D, size_t N>
+std::map<typename GridHandler<D, N>::coord_t, typename GridHandler<D, N>::values_t> GridHandler<D, N>::values()
+    const {
+  if (!values_raw_.empty() || !initialised_)
+    return values_raw_;
+  std::map<coord_t, values_t> out;  // rebuild the list of values from the dense storage
+  for (size_t node = 0; node < num_nodes_; ++node) {
+    coord_t coord(D);
+    for (size_t i = 0; i < D; ++i)
+      coord[i] = coordinates_[i][(node / strides_[i]) % coordinates_[i].size()];
+    values_t vals;
+    for (size_t i = 0; i < N; ++i)
+      vals[i] = values_data_[i * num_nodes_ + node];
+    out[coord] = vals;
+  }
+  return out;
+}
+
+template <size_t D, size_t N>
+void GridHandler<D, N>::setupAxes() {
+  num_nodes_ = 1;
+  for (size_t i = 0; i < D; ++i) {
+    const auto& coordinate = coordinates_[i];
+    strides_[i] = num_nodes_;
+    num_nodes_ *= coordinate.size();
+    inv_steps_[i] = 0.;
+    if (coordinate.size() < 2)
+      continue;
+    // check if the coordinate is regularly spaced to allow a constant-time lookup
+    const auto step = (coordinate.back() - coordinate.front()) / (coordinate.size() - 1);
+    bool regular = true;
+    for (size_t j = 1; j < coordinate.size() && regular; ++j)
+      regular = std::fabs(coordinate[j] - coordinate.front() - j * step) <= 1.e-6 * step;
+    if (regular)
+      inv_steps_[i] = 1. / step;
+  }
+}
+
+template <size_t D, size_t N>
+void GridHandler<D, N>::initialiseInterpolators() {
+  gsl_set_error_handler_off();
 #ifdef GRID_HANDLER_DEBUG
   CG_DEBUG("GridHandler").log([&](auto& dbg) {
     dbg << "Grid dump:";
@@ -188,74 +304,54 @@ void GridHandler<D, N>::initialise() {
 #else
       const unsigned short min_size = type->min_size;
 #endif
-      if (min_size >= values_raw_.size())
+      if (min_size >= num_nodes_)
         throw CG_FATAL("GridHandler") << "Not enough points for \"" << type->name << "\" type of interpolation.\n\t"
-                                      << "Minimum required: " << min_size << ", got " << values_raw_.size() << "!";
-      for (size_t i = 0; i < N; ++i) {
-        values_[i].reset(new double[values_raw_.size()]);
-        splines_1d_.emplace_back(gsl_spline_alloc(type, values_raw_.size()), gsl_spline_free);
-      }
-      // transform a map(coord -> values) to
-      // - 1 vector(coordinates)
-      // - N vectors(values)
-      std::vector<double> x_vec;
-      size_t i = 0;
-      for (const auto& vals : values_raw_) {
-        x_vec.emplace_back(vals.first.at(0));
-        unsigned short j = 0;
-        for (const auto& val : vals.second)
-          values_[j++].get()[i] = val;
-        ++i;
-      }
-      // initialise spline interpolation objects (one for each value)
+                                      << "Minimum required: " << min_size << ", got " << num_nodes_ << "!";
+      splines_1d_.clear();
+      for (size_t i = 0; i < N; ++i)
+        splines_1d_.emplace_back(gsl_spline_alloc(type, num_nodes_), gsl_spline_free);
+      // initialise spline interpolation objects (one for each value) from the dense storage
       for (size_t j = 0; j < splines_1d_.size(); ++j)
-        if (const auto res = gsl_spline_init(splines_1d_.at(j).get(), &x_vec[0], values_[j].get(), values_raw_.size());
+        if (const auto res = gsl_spline_init(
+                splines_1d_.at(j).get(), coordinates_.at(0).data(), &values_data_[j * num_nodes_], num_nodes_);
             res != GSL_SUCCESS)
           CG_WARNING("GridHandler:initialisation")
               << "Failed to initialise spline for dimension " << j << ". GSL error: " << gsl_strerror(res);
     } break;
     case 2: {  //--- (x,y) |-> (f1,...)
 #ifdef GSL_VERSION_ABOVE_2_1
-      if (values_raw_.size() < gsl_interp2d_type_min_size(gsl_interp2d_bicubic))
-        CG_WARNING("GridHandler") << "The grid size is too small (" << values_raw_.size() << " < "
-                                  << gsl_interp2d_type_min_size(gsl_interp2d_bicubic)
-                                  << ") for bicubic interpolation. Switching to a bi-linear interpolation mode.";
-      //const gsl_interp2d_type* type =
-      //    (values_raw_.size() > gsl_interp2d_type_min_size(gsl_interp2d_bicubic) ? gsl_interp2d_bicubic
-      //                                                                           : gsl_interp2d_bilinear);
       const gsl_interp2d_type* type = gsl_interp2d_bilinear;
+      if (interpolation_ == GridInterpolation::cubic) {
+        if (coordinates_.at(0).size() < gsl_interp2d_type_min_size(gsl_interp2d_bicubic) ||
+            coordinates_.at(1).size() < gsl_interp2d_type_min_size(gsl_interp2d_bicubic))
+          CG_WARNING("GridHandler") << "The grid size is too small (" << coordinates_.at(0).size() << "x"
+                                    << coordinates_.at(1).size() << " < "
+                                    << gsl_interp2d_type_min_size(gsl_interp2d_bicubic)
+                                    << ") for bicubic interpolation. Switching to a bi-linear interpolation mode.";
+        else
+          type = gsl_interp2d_bicubic;
+      }
       splines_2d_.clear();
-      for (size_t i = 0; i < N; ++i) {
-        values_[i].reset(new double[coordinates_.at(0).size() * coordinates_.at(1).size()]);
+      for (size_t i = 0; i < N; ++i)
         splines_2d_.emplace_back(gsl_spline2d_alloc(type, coordinates_.at(0).size(), coordinates_.at(1).size()),
                                  gsl_spline2d_free);
-      }
-
-      // second loop over all points to populate the grid
-      for (const auto& [coordinate, value] : values_raw_) {
-        const auto &coord_x = coordinate.at(0), &coord_y = coordinate.at(1);
-        // retrieve the index of the bin in the set
-        const auto id_x =
-                       std::distance(coordinates_.at(0).begin(),
-                                     std::lower_bound(coordinates_.at(0).begin(), coordinates_.at(0).end(), coord_x)),
-                   id_y =
-                       std::distance(coordinates_.at(1).begin(),
-                                     std::lower_bound(coordinates_.at(1).begin(), coordinates_.at(1).end(), coord_y));
-        for (size_t i = 0; i < splines_2d_.size(); ++i)
-          if (const auto res = gsl_spline2d_set(splines_2d_.at(i).get(), values_[i].get(), id_x, id_y, value[i]);
-              res != GSL_SUCCESS)
-            CG_WARNING("GridHandler:initialisation")
-                << "Failed to set value " << i << " for spline. GSL error: " << gsl_strerror(res);
-      }
-
-      // initialise spline interpolation objects (one for each value)
+      // initialise spline interpolation objects (one for each value) from the dense storage
+      // (first coordinate running fastest, as expected by GSL)
       const coord_t &x_vec = coordinates_.at(0), &y_vec = coordinates_.at(1);
       for (size_t i = 0; i < splines_2d_.size(); ++i)
-        gsl_spline2d_init(splines_2d_.at(i).get(), &x_vec[0], &y_vec[0], values_[i].get(), x_vec.size(), y_vec.size());
+        if (const auto res = gsl_spline2d_init(splines_2d_.at(i).get(),
+                                               x_vec.data(),
+                                               y_vec.data(),
+                                               &values_data_[i * num_nodes_],
+                                               x_vec.size(),
+                                               y_vec.size());
+            res != GSL_SUCCESS)
+          CG_WARNING("GridHandler:initialisation")
+              << "Failed to initialise spline for value " << i << ". GSL error: " << gsl_strerror(res);
 #else
       CG_WARNING("GridHandler") << "GSL version ≥ 2.1 is required for spline bilinear interpolation.\n\t"
                                 << "Version " << GSL_VERSION << " is installed on this system!\n\t"
-                                << "Will use a simple bilinear approximation instead.";
+                                << "Will use the dense grid interpolation instead.";
 #endif
     } break;
     default:
@@ -304,49 +400,109 @@ std::array<double, D> GridHandler<D, N>::max() const {
 }
 
 template <size_t D, size_t N>
-void GridHandler<D, N>::findIndices(const coord_t& coord, coord_t& min, coord_t& max) const {
-  for (size_t i = 0; i < D; ++i) {
-    if (const auto& coordinate_i = coordinates_.at(i);  // extract all coordinates registered for this dimension
-        coord.at(i) < *coordinate_i.begin()) {          // under the range
-      CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << i << " in underflow range "
-                                           << "(" << coord.at(i) << " < " << *coordinate_i.begin() << ").";
-      min[i] = max[i] = *coordinate_i.begin();
-    } else if (coord.at(i) > *coordinate_i.rbegin()) {  // over the range
-      CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << i << " in overflow range "
-                                           << "(" << coord.at(i) << " > " << *coordinate_i.rbegin() << ").";
-      min[i] = max[i] = *coordinate_i.rbegin();
-    } else {  // in between two coordinates
-      auto it_coord = std::lower_bound(coordinate_i.begin(), coordinate_i.end(), coord.at(i));
-      max[i] = *it_coord;
-      if (it_coord != coordinate_i.begin())
-        --it_coord;
-      min[i] = *it_coord;
-    }
+typename GridHandler<D, N>::point_t GridHandler<D, N>::transform(const point_t& coord) const {
+  point_t out = coord;
+  switch (grid_type_) {
+    case GridType::logarithmic:
+      std::transform(out.begin(), out.end(), out.begin(), [](const auto& c) { return std::log10(c); });
+      break;
+    case GridType::square:
+      std::transform(out.begin(), out.end(), out.begin(), [](const auto& c) { return c * c; });
+      break;
+    default:
+      break;
   }
+  return out;
 }
 
-//----------------------------------------------------------------------------
-// grid manipulation utility
-//----------------------------------------------------------------------------
+template <size_t D, size_t N>
+void GridHandler<D, N>::locate(size_t dim, double coord, size_t& index, double& frac) const {
+  const auto& coordinate = coordinates_[dim];
+  index = 0;
+  frac = 0.;
+  if (coordinate.size() < 2 || coord <= coordinate.front()) {  // under the range (or single-node coordinate)
+    CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << dim << " in underflow range "
+                                         << "(" << coord << " <= " << coordinate.front() << ").";
+    return;
+  }
+  if (coord >= coordinate.back()) {  // over the range
+    CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << dim << " in overflow range "
+                                         << "(" << coord << " >= " << coordinate.back() << ").";
+    index = coordinate.size() - 2;
+    frac = 1.;
+    return;
+  }
+  if (inv_steps_[dim] > 0.) {  // regularly-spaced coordinate, constant-time lookup
+    const auto pos = (coord - coordinate.front()) * inv_steps_[dim];
+    index = std::min(static_cast<size_t>(pos), coordinate.size() - 2);
+    frac = pos - index;
+    return;
+  }
+  // in between two coordinates
+  index = std::distance(coordinate.begin(), std::upper_bound(coordinate.begin(), coordinate.end(), coord)) - 1;
+  frac = (coord - coordinate[index]) / (coordinate[index + 1] - coordinate[index]);
+}
 
 template <size_t D, size_t N>
-typename GridHandler<D, N>::grid_point_t GridHandler<D, N>::grid_point_t::operator*(double c) const {
-  grid_point_t out = *this;
-  std::transform(out.begin(), out.end(), out.begin(), [&c](const auto& a) { return a * c; });
+typename GridHandler<D, N>::Stencil GridHandler<D, N>::stencil(size_t dim, double coord) const {
+  size_t index;
+  double t;
+  locate(dim, coord, index, t);
+  Stencil out;
+  const auto num_nodes = coordinates_[dim].size();
+  if (interpolation_ == GridInterpolation::cubic && num_nodes >= 4) {
+    const utils::CubicStencil cubic(index, t, num_nodes);
+    out.size = 4;
+    out.weights = cubic.weights;
+    for (size_t i = 0; i < 4; ++i)
+      out.offsets[i] = (cubic.first + i) * strides_[dim];
+    return out;
+  }
+  if (num_nodes < 2) {  // single-node coordinate
+    out.size = 1;
+    out.weights[0] = 1.;
+    return out;
+  }
+  out.size = 2;
+  out.weights = {1. - t, t};
+  out.offsets = {index * strides_[dim], (index + 1) * strides_[dim]};
   return out;
 }
 
 template <size_t D, size_t N>
-typename GridHandler<D, N>::grid_point_t GridHandler<D, N>::grid_point_t::operator+(const grid_point_t& rhs) const {
-  grid_point_t out = *this;
-  for (size_t i = 0; i < out.size(); ++i)
-    out[i] += rhs[i];
+typename GridHandler<D, N>::values_t GridHandler<D, N>::evalDense(const point_t& coord) const {
+  std::array<Stencil, D> stencils;
+  for (size_t i = 0; i < D; ++i)
+    stencils[i] = stencil(i, coord[i]);
+  // loop over all combinations of nodes in the stencils
+  values_t out{};
+  std::array<size_t, D> node{};
+  while (true) {
+    double weight = 1.;
+    size_t offset = 0;
+    for (size_t i = 0; i < D; ++i) {
+      weight *= stencils[i].weights[node[i]];
+      offset += stencils[i].offsets[node[i]];
+    }
+    if (weight != 0.)
+      for (size_t i = 0; i < N; ++i)
+        out[i] += weight * values_data_[i * num_nodes_ + offset];
+    size_t dim = 0;
+    for (; dim < D; ++dim) {  // increment the nodes combination
+      if (++node[dim] < stencils[dim].size)
+        break;
+      node[dim] = 0;
+    }
+    if (dim == D)
+      break;
+  }
   return out;
 }
 
 namespace cepgen {  // template specialisation for the few cases handled
   template class GridHandler<1, 1>;
   template class GridHandler<1, 2>;
+  template class GridHandler<2, 1>;
   template class GridHandler<2, 2>;
   template class GridHandler<3, 1>;
 }  // namespace cepgen
@@ -16,9 +16,13 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
+#include <thread>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
+#include "CepGen/Integration/GridCache.h"
 #include "CepGen/Integration/GridParameters.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
@@ -45,18 +49,40 @@ public:
     desc.add("randomGenerator", RandomGeneratorFactory::get().describeParameters("stl"))
         .setDescription("random number generator engine");
     desc.add("binSize", 3);
+    desc.add("numThreads", 0)
+        .setDescription("number of threads for the grid preparation (0 = as many as the event generation threads)");
     return desc;
   }
 
   void initialise() override {
     grid_ = std::make_unique<GridParameters>(steer<int>("binSize"), integrand_->size());
     coordinates_ = std::vector<double>(integrand_->size());
-    if (!grid_->prepared())
+    if (GridCache::enabled(*run_params_)) {  // try to retrieve the unweighting grid from a previous run
+      if (const GridCache cache(*run_params_); cache.loadGeneration(*integrator_, parameters(), *grid_))
+        integrand_->setStorage(true);
+      else {
+        computeGenerationParameters();
+        cache.saveGeneration(*integrator_, parameters(), *grid_);
+      }
+    } else if (!grid_->prepared())
       computeGenerationParameters();
     CG_DEBUG("GridOptimisedGeneratorWorker:initialise")
         << "Dim-" << integrand_->size() << " " << integrator_->name() << " integrator "
         << "set for dim-" << grid_->n(0).size() << " grid.";
   }
+  void initialiseFrom(const GeneratorWorker& reference) override {
+    const auto* reference_worker = dynamic_cast<const GridOptimisedGeneratorWorker*>(&reference);
+    if (!reference_worker || !reference_worker->grid_ || !reference_worker->grid_->prepared()) {
+      initialise();
+      return;
+    }
+    // each generation thread unweights against its own copy of the maxima, and applies its own correction cycles
+    grid_ = std::make_unique<GridParameters>(*reference_worker->grid_);
+    coordinates_ = std::vector<double>(integrand_->size());
+    integrand_->setStorage(true);
+    CG_DEBUG("GridOptimisedGeneratorWorker:initialiseFrom")
+        << "Unweighting grid copied from reference worker for dim-" << integrand_->size() << " integrand.";
+  }
   bool next() override {
     if (!integrator_)
       throw CG_FATAL("GridOptimisedGeneratorWorker:next") << "No integrator object handled!";
@@ -134,24 +160,96 @@ private:
         << "Preparing the grid (" << utils::s("point", run_params_->generation().numPoints(), true) << "/bin) "
         << "for the generation of unweighted events.";
 
-    const auto inv_num_points = 1. / run_params_->generation().numPoints();
-    std::vector point_coord(integrand_->size(), 0.);
-    if (point_coord.size() < grid_->n(0).size())
+    const auto num_points = run_params_->generation().numPoints();
+    const auto inv_num_points = 1. / num_points;
+    if (integrand_->size() < grid_->n(0).size())
       throw CG_FATAL("GridParameters:setGen") << "Coordinates vector multiplicity is insufficient!";
 
-    // main preparation loop
+    // prepare one integrand and random numbers stream per preparation thread
+    struct Worker {
+      std::unique_ptr<Integrand> integrand_clone;
+      Integrand* integrand{nullptr};
+      std::unique_ptr<utils::RandomGenerator> random_clone;
+      utils::RandomGenerator* random{nullptr};
+    };
+    std::vector<Worker> workers(1);
+    workers[0].integrand = integrand_.get();
+    workers[0].random = random_generator_.get();
+    auto num_threads = steer<int>("numThreads") > 0 ? static_cast<size_t>(steer<int>("numThreads"))
+                                                    : run_params_->generation().numThreads();
+    num_threads = std::max<size_t>(std::min(num_threads, grid_->size()), 1);
+    if (num_threads > 1) {
+      auto rng_params = steer<ParametersList>("randomGenerator");
+      const auto seed = rng_params.get<unsigned long long>("seed");
+      for (size_t i = 1; i < num_threads; ++i) {
+        Worker worker;
+        // decorrelate the random number streams, also from the ones of the generation workers (seed + thread id)
+        if (worker.integrand_clone = integrand_->clone(i << 16); worker.integrand_clone)
+          worker.integrand = worker.integrand_clone.get();
+        else {
+          CG_WARNING("GridOptimisedGeneratorWorker:setGen") << "Integrand cannot be cloned, serial grid preparation.";
+          break;
+        }
+        worker.random_clone = RandomGeneratorFactory::get().build(
+            rng_params.set<unsigned long long>("seed", seed + (i << 16)));
+        worker.random = worker.random_clone.get();
+        workers.emplace_back(std::move(worker));
+      }
+    }
+
+    // main preparation loop, with bins statically distributed among threads for reproducibility
     utils::ProgressBar progress_bar(grid_->size(), 5);
+    std::vector<float> bins_max(grid_->size(), 0.);
+    std::vector<double> bins_av(grid_->size(), 0.), bins_av2(grid_->size(), 0.);
+    std::atomic<size_t> num_prepared_bins{0};
+    const auto prepare = [&](size_t thread_id) {
+      auto& worker = workers.at(thread_id);
+      std::vector<double> point_coord(integrand_->size(), 0.);
+      for (size_t i = thread_id; i < grid_->size(); i += workers.size()) {
+        auto fsum = 0., fsum2 = 0.;
+        auto fmax = 0.f;
+        for (size_t j = 0; j < num_points; ++j) {
+          grid_->shoot(*worker.random, i, point_coord);
+          const auto weight = integrator_->eval(*worker.integrand, point_coord);
+          fmax = std::max(fmax, static_cast<float>(weight));
+          fsum += weight;
+          fsum2 += weight * weight;
+        }
+        bins_max[i] = fmax;
+        bins_av[i] = fsum * inv_num_points;
+        bins_av2[i] = fsum2 * inv_num_points;
+        ++num_prepared_bins;
+        if (thread_id == 0)  // only the calling thread is monitoring the progress
+          progress_bar.update(num_prepared_bins);
+      }
+    };
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(workers.size());
+    for (size_t i = 1; i < workers.size(); ++i)
+      threads.emplace_back([&prepare, &exceptions, i] {
+        try {
+          prepare(i);
+        } catch (...) {
+          exceptions[i] = std::current_exception();
+        }
+      });
+    try {
+      prepare(0);
+    } catch (...) {
+      exceptions[0] = std::current_exception();
+    }
+    for (auto& thread : threads)
+      thread.join();
+    for (const auto& exception : exceptions)
+      if (exception)
+        std::rethrow_exception(exception);
+    progress_bar.update(grid_->size());
+
+    // merge the per-bin maxima into the grid
     auto sum = 0., sum2 = 0., sum2p = 0.;
     for (size_t i = 0; i < grid_->size(); ++i) {
-      auto fsum = 0., fsum2 = 0.;
-      for (size_t j = 0; j < run_params_->generation().numPoints(); ++j) {
-        grid_->shoot(*random_generator_, i, point_coord);
-        const auto weight = integrator_->eval(*integrand_, point_coord);
-        grid_->setValue(i, weight);
-        fsum += weight;
-        fsum2 += weight * weight;
-      }
-      const auto av = fsum * inv_num_points, av2 = fsum2 * inv_num_points, sig2 = av2 - av * av;
+      grid_->setValue(i, bins_max[i]);
+      const auto av = bins_av[i], av2 = bins_av2[i], sig2 = av2 - av * av;
       sum += av;
       sum2 += av2;
       sum2p += sig2;
@@ -165,7 +263,6 @@ private:
                 << "fmax = " << grid_->maxValue(i) << "\n\t"
                 << "eff  = " << eff;
           });
-      progress_bar.update(i + 1);
     }  // end of main preparation loop
 
     CG_DEBUG("GridOptimisedGeneratorWorker:setGen").log([this, &sum, &sum2, &sum2p](auto& log) {
@@ -35,6 +35,7 @@ Logger& Logger::get(std::ostream* os) {
 
 void Logger::addExceptionRule(const std::string& rule) {
   allowed_exc_.emplace_back(rule, std::regex_constants::extended);
+  ++rules_version_;  // invalidate all call site caches
 }
 
 bool Logger::passExceptionRule(const std::string& tmpl, const Level& lev) const {
@@ -0,0 +1,78 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/MappedFile.h"
+
+using namespace cepgen::utils;
+
+MappedFile::MappedFile(const std::string& path) : path_(path) {
+#ifdef _WIN32
+  std::ifstream file(path_, std::ios::binary | std::ios::ate);
+  if (!file.is_open())
+    throw CG_FATAL("MappedFile") << "Failed to open file '" << path_ << "' for reading: " << std::strerror(errno)
+                                 << ".";
+  buffer_.resize(file.tellg());
+  if (!file.seekg(0).read(buffer_.data(), buffer_.size()))
+    throw CG_FATAL("MappedFile") << "Failed to read the content of file '" << path_ << "'.";
+  size_ = buffer_.size();
+  data_ = buffer_.data();
+  CG_DEBUG("MappedFile") << "File '" << path_ << "' read into memory (" << size_ << " bytes).";
+#else
+  const auto fd = ::open(path_.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw CG_FATAL("MappedFile") << "Failed to open file '" << path_ << "' for reading: " << std::strerror(errno)
+                                 << ".";
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw CG_FATAL("MappedFile") << "Failed to retrieve the size of file '" << path_ << "': " << std::strerror(errno)
+                                 << ".";
+  }
+  size_ = st.st_size;
+  if (size_ > 0) {
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    if (data_ == MAP_FAILED) {
+      data_ = nullptr;
+      ::close(fd);
+      throw CG_FATAL("MappedFile") << "Failed to map file '" << path_ << "' into memory: " << std::strerror(errno)
+                                   << ".";
+    }
+  }
+  ::close(fd);  // mapping remains valid once the descriptor is closed
+  CG_DEBUG("MappedFile") << "File '" << path_ << "' mapped into memory (" << size_ << " bytes).";
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (data_)
+    ::munmap(data_, size_);
+#endif
+}
@@ -0,0 +1,50 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Utils/Hasher.h"
+#include "CepGen/Utils/TabulationCache.h"
+
+using namespace cepgen::utils;
+
+TabulationCache::TabulationCache(const std::string& directory, const std::string& name, const std::string& key)
+    : directory_(directory),
+      key_(key),
+      path_(directory.empty()
+                ? ""
+                : (fs::path(directory) / (name + "_" + std::to_string(Hasher<std::string, false>()(key)) + ".grid"))
+                      .string()) {}
+
+void TabulationCache::rejected() const {
+  CG_WARNING("TabulationCache") << "Tabulation stored in '" << path_ << "' was built for another configuration.";
+}
+
+void TabulationCache::publish(const std::function<void(const std::string&)>& writer) const {
+  if (!enabled())
+    return;
+  std::error_code err;
+  fs::create_directories(directory_, err);
+  const auto tmp_path = path_ + ".tmp" + std::to_string(std::random_device()());
+  writer(tmp_path);
+  if (fs::rename(tmp_path, path_, err); err) {
+    CG_WARNING("TabulationCache") << "Failed to store the tabulation into '" << path_ << "': " << err.message() << ".";
+    fs::remove(tmp_path, err);
+  }
+}
@@ -16,68 +16,205 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <sstream>
+#include <unordered_map>
 
 #include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
 using namespace cepgen::utils;
 
+namespace {
+  /// Process-wide registry of all monitoring sites names
+  struct SitesRegistry {
+    static SitesRegistry& get() {
+      static SitesRegistry registry;
+      return registry;
+    }
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, size_t> ids;
+  };
+  std::atomic<size_t> num_time_keepers{0};
+}  // namespace
+
+TimeKeeper::TimeKeeper() : uid_(++num_time_keepers) {}
+
+TimeKeeper::~TimeKeeper() = default;
+
+size_t TimeKeeper::site(const std::string& name) {
+  auto& registry = SitesRegistry::get();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  if (const auto it = registry.ids.find(name); it != registry.ids.end())
+    return it->second;
+  registry.names.emplace_back(name);
+  return registry.ids[name] = registry.names.size() - 1;
+}
+
 void TimeKeeper::clear() {
-  monitors_.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& block : thread_monitors_) {  // monitors are only reset, as they may be cached by the monitoring sites
+    std::lock_guard<std::mutex> block_lock(block->mutex);
+    for (auto& monitor : block->monitors)
+      monitor.clear();
+  }
   tmr_.reset();
 }
 
-TimeKeeper& TimeKeeper::tick(const std::string& func, double time) {
-  monitors_[func].emplace_back(time > 0. ? time : tmr_.elapsed());
+bool TimeKeeper::empty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& block : thread_monitors_) {
+    std::lock_guard<std::mutex> block_lock(block->mutex);
+    if (std::any_of(
+            block->monitors.begin(), block->monitors.end(), [](const auto& mon) { return mon.get().count > 0; }))
+      return false;
+  }
+  return true;
+}
+
+TimeKeeper& TimeKeeper::tick(const std::string& func, double time) { return tick(site(func), time); }
+
+TimeKeeper& TimeKeeper::tick(size_t site_id, double time) {
+  threadMonitor(site_id).add(time > 0. ? time : tmr_.elapsed());
   return *this;
 }
 
-std::string TimeKeeper::summary() const {
-  if (monitors_.empty())
-    return {};
+const Timer& TimeKeeper::timer() const { return tmr_; }
 
-  // a bit of arithmetics
-  struct Monitor {
-    std::string name;
-    size_t size;
-    double total, mean, rms;
-    bool operator<(const Monitor& oth) const { return total < oth.total; }
-  };
+TimeKeeper::ThreadMonitors& TimeKeeper::threadMonitors() {
+  // per-thread cache of the last block used, keyed by the timekeeper unique identifier to avoid any dangling access
+  thread_local std::unordered_map<size_t, ThreadMonitors*> thread_blocks;
+  if (const auto it = thread_blocks.find(uid_); it != thread_blocks.end())
+    return *it->second;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto* block = thread_monitors_.emplace_back(std::make_unique<ThreadMonitors>()).get();
+  thread_blocks[uid_] = block;
+  return *block;
+}
 
-  std::vector<Monitor> mons;
-  double total_time = 0.;
-  for (const auto& mon : monitors_) {
-    const auto& tm = mon.second;
-    const double total = tm.empty() ? -1. : std::accumulate(tm.begin(), tm.end(), 0.);
-    const double mean = total / static_cast<double>(tm.size());
-    const double rms = std::sqrt(std::fabs(
-        std::inner_product(tm.begin(), tm.end(), tm.begin(), 0.) / static_cast<double>(tm.size()) - mean * mean));
-    mons.emplace_back(Monitor{mon.first, tm.size(), total, mean, rms});
-    total_time += total;
+TimeKeeper::ThreadMonitor& TimeKeeper::threadMonitor(size_t site_id) {
+  auto& block = threadMonitors();
+  std::lock_guard<std::mutex> lock(block.mutex);
+  while (block.monitors.size() <= site_id)
+    block.monitors.emplace_back();
+  return block.monitors[site_id];
+}
+
+TimeKeeper::ThreadMonitor& TimeKeeper::monitor(Site& site) {
+  if (site.keeper_uid_ != uid_) {  // first use of this site with this timekeeper in the current thread
+    site.monitor_ = &threadMonitor(site.id_);
+    site.keeper_uid_ = uid_;
   }
+  return *site.monitor_;
+}
+
+std::string TimeKeeper::summary() const {
+  std::vector<std::pair<size_t, Monitor> > monitors;
+  {  // merge all per-thread monitors blocks
+    std::vector<Monitor> merged_monitors;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& block : thread_monitors_) {
+      std::lock_guard<std::mutex> block_lock(block->mutex);
+      if (merged_monitors.size() < block->monitors.size())
+        merged_monitors.resize(block->monitors.size());
+      for (size_t i = 0; i < block->monitors.size(); ++i)
+        merged_monitors[i].merge(block->monitors[i].get());
+    }
+    for (size_t i = 0; i < merged_monitors.size(); ++i)
+      if (merged_monitors[i].count > 0)
+        monitors.emplace_back(i, merged_monitors[i]);
+  }
+  if (monitors.empty())
+    return {};
 
-  std::sort(mons.rbegin(), mons.rend());  // sort by total clock time (desc.)
+  std::sort(monitors.begin(), monitors.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second.sum > rhs.second.sum;
+  });  // sort by total clock time (desc.)
 
   // display the various probes
   static constexpr double s_to_ms = 1.e3;
+  std::vector<std::string> names;
+  {
+    auto& registry = SitesRegistry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    names = registry.names;
+  }
+  double total_time = 0.;
   std::ostringstream oss;
-  oss << format("%2s | %-100s | %12s\t%10s\t%5s", "#", "Caller", "Total (ms)", "Average (ms)", "RMS (ms)");
-  for (const auto& mon : mons)
-    oss << format("\n%10u | %-100s | %12.6f\t%10e\t%5.3e",
-                  mon.size,
-                  mon.name.c_str(),
-                  mon.total * s_to_ms,
-                  mon.mean * s_to_ms,
-                  mon.rms * s_to_ms);
+  oss << format("%2s | %-100s | %12s\t%10s\t%5s\t%10s\t%10s",
+                "#",
+                "Caller",
+                "Total (ms)",
+                "Average (ms)",
+                "RMS (ms)",
+                "Min (ms)",
+                "Max (ms)");
+  for (const auto& [site_id, mon] : monitors) {
+    const auto mean = mon.sum / static_cast<double>(mon.count);
+    const auto rms = std::sqrt(std::fabs(mon.sum2 / static_cast<double>(mon.count) - mean * mean));
+    oss << format("\n%10u | %-100s | %12.6f\t%10e\t%5.3e\t%10e\t%10e",
+                  mon.count,
+                  names.at(site_id).c_str(),
+                  mon.sum * s_to_ms,
+                  mean * s_to_ms,
+                  rms * s_to_ms,
+                  mon.min * s_to_ms,
+                  mon.max * s_to_ms);
+    total_time += mon.sum;
+  }
   oss << "\nTotal time: " << total_time << ".";
   return oss.str();
 }
 
-TimeKeeper::Ticker::Ticker(TimeKeeper* tk, const std::string& name) : tk_(tk), name_(name) {}
+void TimeKeeper::Monitor::merge(const Monitor& oth) {
+  if (oth.count == 0)
+    return;
+  min = count == 0 ? oth.min : std::min(min, oth.min);
+  max = count == 0 ? oth.max : std::max(max, oth.max);
+  sum += oth.sum;
+  sum2 += oth.sum2;
+  count += oth.count;
+}
+
+TimeKeeper::Ticker::Ticker(TimeKeeper* tk, const std::string& name) : tk_(tk), site_id_(tk ? site(name) : 0) {}
+
+void TimeKeeper::ThreadMonitor::add(double time) {
+  // only the owning thread is writing, hence no read-modify-write operation is required
+  const auto count = count_.load(std::memory_order_relaxed);
+  min_.store(count == 0 ? time : std::min(min_.load(std::memory_order_relaxed), time), std::memory_order_relaxed);
+  max_.store(count == 0 ? time : std::max(max_.load(std::memory_order_relaxed), time), std::memory_order_relaxed);
+  sum_.store(sum_.load(std::memory_order_relaxed) + time, std::memory_order_relaxed);
+  sum2_.store(sum2_.load(std::memory_order_relaxed) + time * time, std::memory_order_relaxed);
+  count_.store(count + 1, std::memory_order_relaxed);
+}
+
+void TimeKeeper::ThreadMonitor::clear() {
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0., std::memory_order_relaxed);
+  sum2_.store(0., std::memory_order_relaxed);
+  min_.store(0., std::memory_order_relaxed);
+  max_.store(0., std::memory_order_relaxed);
+}
+
+TimeKeeper::Monitor TimeKeeper::ThreadMonitor::get() const {
+  Monitor monitor;
+  monitor.count = count_.load(std::memory_order_relaxed);
+  monitor.sum = sum_.load(std::memory_order_relaxed);
+  monitor.sum2 = sum2_.load(std::memory_order_relaxed);
+  monitor.min = min_.load(std::memory_order_relaxed);
+  monitor.max = max_.load(std::memory_order_relaxed);
+  return monitor;
+}
+
+TimeKeeper::Ticker::Ticker(TimeKeeper* tk, Site& site)
+    : tk_(tk), site_id_(site.id_), monitor_(tk ? &tk->monitor(site) : nullptr) {}
 
 TimeKeeper::Ticker::~Ticker() {
-  if (tk_)
-    tk_->tick(name_, tmr_.elapsed());
+  if (monitor_)
+    monitor_->add(tmr_.elapsed());
+  else if (tk_)
+    tk_->tick(site_id_, tmr_.elapsed());
 }
@@ -0,0 +1,101 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/EventFilter/EventModifier.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/GridCache.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace std;
+
+namespace {
+  /// Dummy modification algorithm only steered by its parameters
+  class TestModifier final : public cepgen::EventModifier {
+  public:
+    explicit TestModifier(const cepgen::ParametersList& params) : cepgen::EventModifier(params) {}
+    bool run(cepgen::Event&, double&, bool) override { return true; }
+  };
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  string input_card, cache_directory;
+  int num_events;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("config,i", "path to the configuration file", &input_card, "Cards/lpair_cfg.py")
+      .addOptionalArgument("num-events,n", "number of events to generate", &num_events, 100)
+      .addOptionalArgument("cache,c", "grids cache directory", &cache_directory, "cepgen_grid_cache_test")
+      .parse();
+
+  fs::remove_all(cache_directory);
+
+  const auto run = [&input_card, &cache_directory, &num_events]() {
+    cepgen::Generator gen;
+    gen.parseRunParameters(input_card);
+    gen.runParameters().eventExportersSequence().clear();
+    gen.runParameters().generation().setGridCache(cache_directory);
+    const auto cross_section = gen.computeXsection();
+    gen.generate(num_events);
+    return cross_section;
+  };
+  const auto first_cross_section = run();
+  CG_TEST(!fs::is_empty(cache_directory), "grids cache populated by the first run");
+  const auto second_cross_section = run();  // this run should be using the cached grids
+  CG_TEST_EQUAL((double)first_cross_section, (double)second_cross_section, "cached cross-section value");
+  CG_TEST_EQUAL(first_cross_section.uncertainty(), second_cross_section.uncertainty(), "cached cross-section unc.");
+
+  {  // cache entries must only be retrieved for the very configuration they were computed with
+    cepgen::Generator gen;
+    gen.parseRunParameters(input_card);
+    gen.runParameters().generation().setGridCache(cache_directory);
+    gen.computeXsection();
+    for (const auto& entry : fs::directory_iterator(cache_directory))
+      if (entry.path().extension() == ".cgrid" && entry.path().stem().extension() == ".integration") {
+        fstream file(entry.path(), ios::in | ios::out | ios::binary);
+        file.seekp(28);  // alter the stored configuration (after magic, version, hash, and string size), not its hash
+        file.put('#');
+      }
+    cepgen::Value cross_section;
+    CG_TEST(!cepgen::GridCache(gen.runParameters()).loadIntegration(gen.integrator(), cross_section),
+            "cache entry rejected on configuration mismatch");
+  }
+
+  {  // modifiers differing only by their steering parameters must not share their cache entries
+    const auto modified_key = [&input_card, &cache_directory](int parameter, int seed) {
+      cepgen::Generator gen;
+      gen.parseRunParameters(input_card);
+      gen.runParameters().eventModifiersSequence().clear();
+      gen.runParameters().generation().setGridCache(cache_directory);
+      gen.runParameters().addModifier(std::make_unique<TestModifier>(
+          cepgen::ParametersList().setName("test").set<int>("parameter", parameter).set<int>("seed", seed)));
+      return cepgen::GridCache(gen.runParameters()).key();
+    };
+    CG_TEST(modified_key(1, 0) != modified_key(2, 0), "cache key depends on modifier parameters");
+    CG_TEST_EQUAL(modified_key(1, 0), modified_key(1, 42), "cache key independent of modifier seed");
+  }
+
+  fs::remove_all(cache_directory);
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,76 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/ProcessFactory.h"
+#include "CepGen/Physics/CompiledCuts.h"
+#include "CepGen/Process/Process.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string proc_name;
+  int num_points;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("process,p", "process to evaluate", &proc_name, "lpair")
+      .addOptionalArgument("num-points,n", "number of phase space points to probe", &num_points, 1000)
+      .parse();
+  cepgen::initialise();
+
+  auto process = cepgen::ProcessFactory::get().build(proc_name, cepgen::ParametersList().set<int>("pair", 13));
+  process->kinematics().setParameters(cepgen::ParametersList().set<double>("sqrtS", 13.e3).set<int>("mode", 1));
+  {  // default restrictions (e.g. pt >= 0) cannot reject anything; no cut is to be evaluated
+    CG_TEST(cepgen::cuts::Compiled(process->kinematics()).empty(), "no active cut for default kinematics");
+    auto restricted_kinematics = process->kinematics();
+    restricted_kinematics.setParameters(cepgen::ParametersList().set<double>("ptmin", 5.));
+    CG_TEST(!cepgen::cuts::Compiled(restricted_kinematics).empty(), "active cut for restricted kinematics");
+  }
+
+  cepgen::ProcessIntegrand fast_integrand(*process), full_integrand(*process);
+  full_integrand.setStorage(true);  // forces the event content to be built for each phase space point
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::vector<double> coordinates(fast_integrand.size());
+  size_t num_differences = 0, num_rejected_by_cuts = 0, num_accepted = 0;
+  for (int i = 0; i < num_points; ++i) {
+    for (auto& coordinate : coordinates)
+      coordinate = uniform(rng);
+    const auto fast_weight = fast_integrand.eval(coordinates), full_weight = full_integrand.eval(coordinates);
+    if (fast_weight != full_weight)
+      ++num_differences;
+    if (full_weight <= 0.)
+      continue;
+    ++num_accepted;
+    const auto& event = full_integrand.process().event();  // full (non-compiled) cuts evaluation
+    if (!full_integrand.process().kinematics().cuts().central.contain(event(cepgen::Particle::Role::CentralSystem),
+                                                                      &event))
+      ++num_rejected_by_cuts;
+  }
+  CG_TEST(num_accepted > 0, "phase space points accepted");
+  CG_TEST_EQUAL(num_differences, 0ul, "fast path weights equal to full path weights");
+  CG_TEST_EQUAL(num_rejected_by_cuts, 0ul, "full path cuts reject none of the fast path points");
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,87 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/EventExporterFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/EventUtils.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/String.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string output_file;
+  int num_events;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("output,o", "path to the output LHEF file", &output_file, "test_lhef_writer.lhe")
+      .addOptionalArgument("num-events,n", "number of events to store", &num_events, 25)
+      .parse();
+  cepgen::initialise();
+
+  const auto evt = cepgen::utils::generateLPAIREvent();
+  {  // small buffer size to test several flushes to the output file
+    auto lhef = cepgen::EventExporterFactory::get().build(
+        "lhef", cepgen::ParametersList().set("filename", output_file).set("bufferSize", 2048));
+    lhef->setCrossSection(cepgen::Value{1.23, 0.04});
+    for (int i = 0; i < num_events; ++i)
+      *lhef << evt;
+  }
+  CG_TEST(cepgen::utils::fileExists(output_file), "output file existence");
+
+  int num_stored_events = 0, num_invalid_multiplicity = 0, num_invalid_mothers = 0;
+  size_t num_particles = 0, num_lines = 0;
+  bool in_init = false, in_event = false, closed = false;
+  double cross_section = 0.;
+  for (const auto& line : cepgen::utils::split(cepgen::utils::readFile(output_file), '\n')) {
+    const auto fields = cepgen::utils::split(cepgen::utils::trim(line), ' ', true);
+    if (line == "<init>")
+      in_init = true, num_lines = 0;
+    else if (line == "</init>")
+      in_init = false;
+    else if (line == "<event>")
+      in_event = true, num_lines = 0;
+    else if (line == "</event>") {
+      if (num_lines != num_particles + 1)
+        ++num_invalid_multiplicity;
+      ++num_stored_events;
+      in_event = false;
+    } else if (line == "</LesHouchesEvents>")
+      closed = true;
+    else if (in_init && ++num_lines == 2)
+      cross_section = stod(fields.at(0));
+    else if (in_event && ++num_lines == 1)
+      num_particles = stoul(fields.at(0));
+    else if (in_event && stoi(fields.at(0)) == 13 && (stoi(fields.at(2)) != 1 || stoi(fields.at(3)) != 2))
+      ++num_invalid_mothers;  // central system particles are expected to be produced by the two incoming partons
+  }
+  CG_TEST(closed, "LHEF closing tag");
+  CG_TEST_EQUIV(cross_section, 1.23, "cross section in initialisation block");
+  CG_TEST_EQUAL(num_stored_events, num_events, "number of stored events");
+  CG_TEST_EQUAL(num_particles, 6ul, "particles multiplicity in event header");
+  CG_TEST_EQUAL(num_invalid_multiplicity, 0, "events with inconsistent particles multiplicity");
+  CG_TEST_EQUAL(num_invalid_mothers, 0, "events with invalid central system parentage");
+  remove(output_file.c_str());
+
+  CG_TEST_SUMMARY;
+}
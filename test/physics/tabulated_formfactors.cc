@@ -0,0 +1,87 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <random>
+
+#include "CepGen/FormFactors/Parameterisation.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/FormFactorsFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_points;
+  double tolerance;
+  string cache_directory;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-points,n", "number of comparison points", &num_points, 100)
+      .addOptionalArgument("tolerance,t", "maximal relative difference allowed", &tolerance, 1.e-3)
+      .addOptionalArgument("cache,c", "tabulations cache directory", &cache_directory, "cepgen_tabulation_cache_test")
+      .parse();
+  cepgen::initialise();
+
+  const cepgen::Limits q2_range{1.e-2, 1.e2};
+  const auto params = cepgen::ParametersList().set("computeFM", true).set("q2Range", q2_range);
+  auto build = [&params](bool tabulate, const string& directory = "") {
+    return cepgen::FormFactorsFactory::get().build(
+        "InelasticNucleon",
+        cepgen::ParametersList(params).set("tabulate", tabulate).set("cacheDirectory", directory));
+  };
+  auto direct = build(false), tabulated = build(true);
+
+  vector<double> q2_values{q2_range.min(), q2_range.max()};
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> log_q2(std::log(q2_range.min()), std::log(q2_range.max()));
+  for (int i = 0; i < num_points; ++i)
+    q2_values.emplace_back(std::exp(log_q2(gen)));
+  double max_diff_fe = 0., max_diff_fm = 0.;
+  for (const auto& q2 : q2_values) {
+    const auto ff_direct = (*direct)(q2), ff_tabulated = (*tabulated)(q2);
+    if (ff_direct.FE != 0.)
+      max_diff_fe = std::max(max_diff_fe, std::fabs(ff_tabulated.FE / ff_direct.FE - 1.));
+    if (ff_direct.FM != 0.)
+      max_diff_fm = std::max(max_diff_fm, std::fabs(ff_tabulated.FM / ff_direct.FM - 1.));
+  }
+  CG_TEST(max_diff_fe < tolerance, "tabulated FE within the tabulation range");
+  CG_TEST(max_diff_fm < tolerance, "tabulated FM within the tabulation range");
+  // points just outside the tabulated range are computed from the full integration
+  for (const auto& q2 : {0.99 * q2_range.min(), 1.01 * q2_range.max()}) {
+    const auto ff_direct = (*direct)(q2), ff_tabulated = (*tabulated)(q2);
+    CG_TEST_EQUAL(ff_tabulated.FE, ff_direct.FE, "out-of-table FE");
+    CG_TEST_EQUAL(ff_tabulated.FM, ff_direct.FM, "out-of-table FM");
+  }
+
+  {  // tabulations are persisted into the cache directory
+    fs::remove_all(cache_directory);
+    auto cached = build(true, cache_directory);
+    CG_TEST(fs::exists(cache_directory) && !fs::is_empty(cache_directory), "tabulation cache populated");
+    for (const auto& entry : fs::directory_iterator(cache_directory))
+      CG_TEST((cepgen::GridHandler<1, 2>::isBinary(entry.path().string())), "binary tabulation cache file");
+    const auto q2 = q2_values.back();
+    CG_TEST_EQUAL((*cached)(q2).FE, (*tabulated)(q2).FE, "FE from cached tabulation");
+    fs::remove_all(cache_directory);
+  }
+
+  CG_TEST_SUMMARY;
+}
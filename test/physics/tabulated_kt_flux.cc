@@ -0,0 +1,86 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <random>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/PartonFluxFactory.h"
+#include "CepGen/PartonFluxes/CollinearFlux.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string kt_flux;
+  int num_points;
+  double tolerance;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("kt-flux,f", "unintegrated flux to integrate", &kt_flux, "BudnevElastic")
+      .addOptionalArgument("num-points,n", "number of comparison points", &num_points, 100)
+      .addOptionalArgument("tolerance,t", "maximal relative difference allowed", &tolerance, 1.e-2)
+      .parse();
+  cepgen::initialise();
+
+  const cepgen::Limits x_range{1.e-4, 0.5}, q2_range{1.e-2, 1.e2};
+  const int num_x_nodes = 200, num_q2_nodes = 100;
+  const auto kt_flux_params = cepgen::KTFluxFactory::get().describeParameters(kt_flux).parameters();
+  auto direct =
+      cepgen::CollinearFluxFactory::get().build("KTIntegrated", cepgen::ParametersList().set("ktFlux", kt_flux_params));
+  auto tabulated = cepgen::CollinearFluxFactory::get().build("KTIntegrated",
+                                                             cepgen::ParametersList()
+                                                                 .set("ktFlux", kt_flux_params)
+                                                                 .set("tabulate", true)
+                                                                 .set("xTabRange", x_range)
+                                                                 .set("q2TabRange", q2_range)
+                                                                 .set("numXPoints", num_x_nodes)
+                                                                 .set("numScalePoints", num_q2_nodes));
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> log_x(std::log(1.e-3), std::log(0.1)), log_q2(std::log(1.e-1), std::log(10.));
+  double max_diff = 0.;
+  for (int i = 0; i < num_points; ++i) {
+    const auto x = std::exp(log_x(gen)), q2 = std::exp(log_q2(gen));
+    if (const auto flux = direct->fluxQ2(x, q2); flux != 0.)
+      max_diff = std::max(max_diff, std::fabs(tabulated->fluxQ2(x, q2) / flux - 1.));
+  }
+  CG_TEST(max_diff < tolerance, "kt-integrated flux interpolation for " + kt_flux);
+  {  // first and last cells along each axis
+    // point at a given fraction of a cell from the lower (positive fraction) or upper (negative fraction) range edge
+    const auto edge = [](const cepgen::Limits& range, int num_nodes, double cell_fraction) {
+      const auto step = std::log(range.max() / range.min()) / (num_nodes - 1);
+      return (cell_fraction < 0. ? range.max() : range.min()) * std::exp(cell_fraction * step);
+    };
+    vector<pair<double, double> > edge_points;
+    for (const auto& cell_fraction : {0., 0.25, 0.5, 0.75, -0.75, -0.5, -0.25}) {
+      edge_points.emplace_back(edge(x_range, num_x_nodes, cell_fraction), 1.);
+      edge_points.emplace_back(1.e-2, edge(q2_range, num_q2_nodes, cell_fraction));
+    }
+    double max_diff_edges = 0.;
+    for (const auto& [x, q2] : edge_points)
+      if (const auto flux = direct->fluxQ2(x, q2); flux != 0.)
+        max_diff_edges = std::max(max_diff_edges, std::fabs(tabulated->fluxQ2(x, q2) / flux - 1.));
+    CG_TEST(max_diff_edges < tolerance, "kt-integrated flux interpolation in the edge cells for " + kt_flux);
+  }
+  // out-of-table points are computed from the full integration
+  CG_TEST_EQUAL(tabulated->fluxQ2(1.e-5, 1.), direct->fluxQ2(1.e-5, 1.), "out-of-table flux for " + kt_flux);
+
+  CG_TEST_SUMMARY;
+}
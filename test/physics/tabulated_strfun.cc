@@ -0,0 +1,81 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <random>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string model;
+  int num_points;
+  double tolerance;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("model,m", "structure functions parameterisation to tabulate", &model, "ALLM97")
+      .addOptionalArgument("num-points,n", "number of comparison points", &num_points, 1000)
+      .addOptionalArgument("tolerance,t", "maximal relative difference allowed", &tolerance, 1.e-2)
+      .parse();
+  cepgen::initialise();
+
+  const cepgen::Limits xbj_range{1.e-5, 0.9}, q2_range{1.e-1, 1.e3};
+  const int num_nodes = 250;
+  auto direct = cepgen::StructureFunctionsFactory::get().build(model);
+  auto tabulated = cepgen::StructureFunctionsFactory::get().build(
+      "Tabulated",
+      cepgen::ParametersList()
+          .set("model", cepgen::StructureFunctionsFactory::get().describeParameters(model).parameters())
+          .set("xbjRange", xbj_range)
+          .set("Q2range", q2_range)
+          .set("numXbjPoints", num_nodes)
+          .set("numQ2Points", num_nodes));
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> log_xbj(std::log(1.e-4), std::log(0.5)), log_q2(std::log(1.), std::log(1.e2));
+  double max_diff_f2 = 0., max_diff_fl = 0.;
+  for (int i = 0; i < num_points; ++i) {
+    const auto xbj = std::exp(log_xbj(gen)), q2 = std::exp(log_q2(gen));
+    if (const auto f2 = direct->F2(xbj, q2); f2 != 0.)
+      max_diff_f2 = std::max(max_diff_f2, std::fabs(tabulated->F2(xbj, q2) / f2 - 1.));
+    if (const auto fl = direct->FL(xbj, q2); fl != 0.)
+      max_diff_fl = std::max(max_diff_fl, std::fabs(tabulated->FL(xbj, q2) / fl - 1.));
+  }
+  CG_TEST(max_diff_f2 < tolerance, "F2 interpolation for " + model);
+  CG_TEST(max_diff_fl < tolerance, "FL interpolation for " + model);
+  {  // first and last cells along each axis
+    const auto lx_step = std::log(xbj_range.max() / xbj_range.min()) / (num_nodes - 1),
+               lq2_step = std::log(q2_range.max() / q2_range.min()) / (num_nodes - 1);
+    double max_diff_edges = 0.;
+    for (const auto& pos : {0., 0.25, 0.5, 0.75, num_nodes - 1.75, num_nodes - 1.5, num_nodes - 1.25, num_nodes - 1.})
+      for (const auto& [xbj, q2] : {std::make_pair(xbj_range.min() * std::exp(pos * lx_step), 10.),
+                                    std::make_pair(1.e-2, q2_range.min() * std::exp(pos * lq2_step))})
+        if (const auto f2 = direct->F2(xbj, q2); f2 != 0.)
+          max_diff_edges = std::max(max_diff_edges, std::fabs(tabulated->F2(xbj, q2) / f2 - 1.));
+    CG_TEST(max_diff_edges < tolerance, "F2 interpolation in the edge cells for " + model);
+  }
+  // out-of-table points are computed from the full parameterisation
+  CG_TEST_EQUAL(tabulated->F2(1.e-7, 10.), direct->F2(1.e-7, 10.), "out-of-table F2 for " + model);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,85 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+#include <random>
+
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/FunctionalFactory.h"
+#include "CepGen/Modules/ProcessFactory.h"
+#include "CepGen/Process/Process.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Functional.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+/// A constant functional, independent of any parser add-on
+class ConstantFunctional final : public cepgen::utils::Functional {
+public:
+  explicit ConstantFunctional(const cepgen::ParametersList& params)
+      : Functional(params), value_(std::stod(expression())) {}
+
+private:
+  double eval() const override { return value_; }
+  const double value_;
+};
+REGISTER_FUNCTIONAL("test_constant", ConstantFunctional);
+
+int main(int argc, char* argv[]) {
+  string proc_name;
+  int num_points;
+  double taming_value;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("process,p", "process to evaluate", &proc_name, "lpair")
+      .addOptionalArgument("num-points,n", "number of phase space points to probe", &num_points, 100)
+      .addOptionalArgument("taming-value,t", "constant value of the taming function", &taming_value, 0.25)
+      .parse();
+  cepgen::initialise();
+
+  auto process = cepgen::ProcessFactory::get().build(proc_name, cepgen::ParametersList().set<int>("pair", 13));
+  process->kinematics().setParameters(cepgen::ParametersList().set<double>("sqrtS", 13.e3).set<int>("mode", 1));
+
+  cepgen::RunParameters run_parameters;
+  run_parameters.setProcess(process->clone());
+  run_parameters.addTamingFunction(cepgen::FunctionalFactory::get().build(
+      "test_constant", cepgen::utils::Functional::fromExpression(to_string(taming_value), {"m(4)"})));
+
+  cepgen::ProcessIntegrand untamed_integrand(*process), tamed_integrand(&run_parameters);
+  untamed_integrand.setStorage(true);  // both integrands are evaluated from the event content
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+  std::vector<double> coordinates(untamed_integrand.size());
+  size_t num_accepted = 0, num_differences = 0;
+  for (int i = 0; i < num_points; ++i) {
+    for (auto& coordinate : coordinates)
+      coordinate = uniform(rng);
+    const auto untamed_weight = untamed_integrand.eval(coordinates), tamed_weight = tamed_integrand.eval(coordinates);
+    if (untamed_weight <= 0.)
+      continue;
+    ++num_accepted;
+    if (std::fabs(tamed_weight - taming_value * untamed_weight) > 1.e-12 * untamed_weight)
+      ++num_differences;
+  }
+  CG_TEST(num_accepted > 0, "phase space points accepted");
+  CG_TEST_EQUAL(num_differences, 0ul, "weights rescaled by the taming function value");
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,96 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/AsynchronousExporters.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/EventUtils.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+/// Slow output module checking the order of the events it receives
+class OrderedExporter final : public cepgen::EventExporter {
+public:
+  explicit OrderedExporter(long long fail_at = -1) : EventExporter(cepgen::ParametersList()), fail_at_(fail_at) {}
+  bool operator<<(const cepgen::Event& event) override {
+    this_thread::sleep_for(chrono::microseconds(100));
+    if (static_cast<long long>(event_num_) == fail_at_)
+      throw runtime_error("output module failure");
+    if (event.metadata(cepgen::Event::EventMetadata::WEIGHT) != event_num_)
+      ++num_unordered;
+    ++event_num_;
+    return true;
+  }
+  unsigned long long numEvents() const { return event_num_; }
+  size_t num_unordered{0};
+
+private:
+  const long long fail_at_;
+};
+
+int main(int argc, char* argv[]) {
+  int num_events, buffer_size;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-events,n", "number of events to export", &num_events, 500)
+      .addOptionalArgument("buffer-size,b", "events buffer size for each output module", &buffer_size, 8)
+      .parse();
+  cepgen::initialise();
+
+  auto evt = cepgen::utils::generateLPAIREvent();
+  {  // events order and numbering are preserved for all output modules
+    vector<unique_ptr<cepgen::EventExporter> > exporters;
+    exporters.emplace_back(new OrderedExporter);
+    exporters.emplace_back(new OrderedExporter);
+    cepgen::AsynchronousExporters async_exporters(exporters, buffer_size);
+    for (int i = 0; i < num_events; ++i) {
+      evt.metadata[cepgen::Event::EventMetadata::WEIGHT] = i;
+      CG_TEST(async_exporters << evt, "event queued");
+    }
+    async_exporters.flush();
+    for (const auto& exporter : exporters) {
+      const auto& ordered_exporter = dynamic_cast<const OrderedExporter&>(*exporter);
+      CG_TEST_EQUAL(ordered_exporter.numEvents(), static_cast<unsigned long long>(num_events), "events written");
+      CG_TEST_EQUAL(ordered_exporter.num_unordered, 0ul, "events order");
+    }
+  }
+  {  // output module failures are propagated to the generating thread
+    vector<unique_ptr<cepgen::EventExporter> > exporters;
+    exporters.emplace_back(new OrderedExporter(num_events / 2));
+    cepgen::AsynchronousExporters async_exporters(exporters, buffer_size);
+    bool caught = false;
+    try {
+      for (int i = 0; i < num_events; ++i) {
+        evt.metadata[cepgen::Event::EventMetadata::WEIGHT] = i;
+        async_exporters << evt;
+      }
+      async_exporters.flush();
+    } catch (const runtime_error&) {
+      caught = true;
+    }
+    CG_TEST(caught, "output module exception propagation");
+  }
+
+  CG_TEST_SUMMARY;
+}
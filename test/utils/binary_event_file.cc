@@ -0,0 +1,137 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <thread>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/EventFilter/EventImporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/EventExporterFactory.h"
+#include "CepGen/Modules/EventImporterFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/BinaryEventFile.h"
+#include "CepGen/Utils/EventUtils.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  int num_events, chunk_size, num_threads;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-events,n", "number of events to store", &num_events, 250)
+      .addOptionalArgument("chunk-size,c", "number of events per chunk", &chunk_size, 16)
+      .addOptionalArgument("num-threads,t", "number of parallel readers", &num_threads, 4)
+      .parse();
+  cepgen::initialise();
+
+  const string filename = "test_binary_event_file.cgevt";
+  const auto cross_section = cepgen::Value{1.23, 0.04};
+  auto evt_base = cepgen::utils::generateLPAIREvent();
+  {  // add a particle without any definite role (e.g. as produced by external hadronisers)
+    auto& radiated = evt_base.addParticle(cepgen::Particle::Role::UnknownRole).get();
+    radiated.setPdgId(22).setStatus(cepgen::Particle::Status::FinalState);
+    radiated.setMomentum(cepgen::Momentum::fromPxPyPzE(1., 0., 0., 1.));
+    radiated.addMother(evt_base[evt_base(cepgen::Particle::Role::CentralSystem).at(0).id()]);
+  }
+  const auto custom_key = cepgen::Event::EventMetadata::key("custom");
+  {  // write events with a varying weight
+    auto writer = cepgen::EventExporterFactory::get().build(
+        "binary", cepgen::ParametersList().set("filename", filename).set("chunkSize", chunk_size));
+    writer->setCrossSection(cross_section);
+    for (int i = 0; i < num_events; ++i) {
+      evt_base.metadata[cepgen::Event::EventMetadata::WEIGHT] = i;
+      evt_base.metadata[custom_key] = 0.5 * i;
+      (*writer) << evt_base;
+    }
+  }
+  CG_TEST(cepgen::utils::BinaryEventReader::isBinary(filename), "binary events file identification");
+
+  {  // random access to the file content
+    const cepgen::utils::BinaryEventReader reader(filename);
+    CG_TEST_EQUAL(reader.size(), static_cast<size_t>(num_events), "number of stored events");
+    CG_TEST_EQUAL(reader.crossSection(), cross_section, "stored cross-section");
+    cepgen::Event evt;
+    for (const auto& index : {num_events - 1, chunk_size, chunk_size - 1, 0}) {
+      reader.read(index, evt);
+      CG_TEST_EQUAL(evt.metadata(cepgen::Event::EventMetadata::WEIGHT), index, "event weight (random access)");
+      CG_TEST_EQUAL(evt.metadata(custom_key), 0.5f * index, "custom metadata (random access)");
+    }
+    CG_TEST(evt.particles() == evt_base.particles(), "particles content");
+    for (const auto& part : evt_base.particles()) {
+      CG_TEST(evt(part.id()).mothers() == part.mothers(), "particle mothers");
+      CG_TEST(evt(part.id()).children() == part.children(), "particle children");
+      CG_TEST_EQUAL(evt(part.id()).role(), part.role(), "particle role");
+    }
+    CG_TEST(evt.hasRole(cepgen::Particle::Role::UnknownRole), "undefined role particles");
+    CG_TEST(evt.roles().back() == cepgen::Particle::Role::UnknownRole, "undefined role particles iterated last");
+  }
+
+  {  // parallel readback of interleaved events
+    vector<unique_ptr<cepgen::EventImporter> > importers;
+    for (int i = 0; i < num_threads; ++i)
+      importers.emplace_back(cepgen::EventImporterFactory::get().build(
+          "binary",
+          cepgen::ParametersList().set("filename", filename).set("firstEvent", i).set("stride", num_threads)));
+    vector<double> sum_weights(num_threads, 0.);
+    vector<size_t> num_read(num_threads, 0);
+    vector<thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads.emplace_back([&, i]() {
+        cepgen::Event evt;
+        while ((*importers.at(i)) >> evt) {
+          sum_weights.at(i) += evt.metadata(cepgen::Event::EventMetadata::WEIGHT);
+          ++num_read.at(i);
+        }
+      });
+    for (auto& thr : threads)
+      thr.join();
+    CG_TEST_EQUAL(accumulate(num_read.begin(), num_read.end(), 0ul),
+                  static_cast<size_t>(num_events),
+                  "number of events read in parallel");
+    CG_TEST_EQUAL(accumulate(sum_weights.begin(), sum_weights.end(), 0.),
+                  0.5 * num_events * (num_events - 1),
+                  "sum of weights read in parallel");
+    CG_TEST_EQUAL(importers.at(0)->crossSection(), cross_section, "importer cross-section");
+  }
+  {  // recovery of all complete chunks from a truncated file (e.g. written by an interrupted run)
+    string content;
+    {
+      ifstream file(filename, ios::binary);
+      content.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+    }
+    const string truncated_filename = "test_binary_event_file_truncated.cgevt";
+    ofstream(truncated_filename, ios::binary).write(content.data(), content.rfind("CHNK") + 10);  // within last chunk
+    const cepgen::utils::BinaryEventReader reader(truncated_filename);
+    const auto num_recovered = (num_events - 1) / chunk_size * chunk_size;  // all chunks but the last one
+    CG_TEST_EQUAL(reader.size(), static_cast<size_t>(num_recovered), "number of recovered events");
+    cepgen::Event evt;
+    reader.read(num_recovered - 1, evt);
+    CG_TEST_EQUAL(evt.metadata(cepgen::Event::EventMetadata::WEIGHT), num_recovered - 1, "recovered event weight");
+    CG_TEST_EQUAL(evt.metadata("custom"), 0.5f * (num_recovered - 1), "recovered custom metadata");
+    CG_TEST(evt.particles() == evt_base.particles(), "recovered particles content");
+    remove(truncated_filename.c_str());
+  }
+  remove(filename.c_str());
+
+  CG_TEST_SUMMARY;
+}
@@ -42,5 +42,7 @@ int main(int argc, char* argv[]) {
   const cepgen::utils::EventBrowser bws;
   for (const auto& [variable_name, value] : values)
     CG_TEST_EQUIV(bws.get(evt, variable_name), value, variable_name);
+  for (const auto& [variable_name, value] : values)
+    CG_TEST_EQUIV(bws.compile(variable_name)(evt), value, "compiled " + variable_name);
   CG_TEST_SUMMARY;
 }
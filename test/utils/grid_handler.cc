@@ -0,0 +1,80 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstdio>
+
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  cepgen::ArgumentsParser(argc, argv).parse();
+  CG_TEST_SET_PRECISION(1.e-10);
+
+  const auto linear = [](double x, double y, double z) { return 1. + 2. * x - 0.5 * y + 3. * z; };
+  const auto quadratic = [](double x, double, double z) { return x * x - 2. * x * z + 0.5 * z * z; };
+  cepgen::GridHandler<3, 1> lin_grid(cepgen::GridType::linear),
+      cub_grid(cepgen::GridType::linear, cepgen::GridInterpolation::cubic);
+  // regularly-spaced x and z coordinates, irregular y coordinate
+  const vector<double> y_nodes{-1., -0.5, -0.2, 0., 0.1, 0.5, 1.2, 2.};
+  for (int i = 0; i <= 10; ++i)
+    for (const auto& y : y_nodes)
+      for (int k = 0; k <= 8; ++k) {
+        const auto x = -1. + 0.2 * i, z = 0.25 * k;
+        lin_grid.insert({x, y, z}, {linear(x, y, z)});
+        cub_grid.insert({x, y, z}, {quadratic(x, y, z)});
+      }
+  lin_grid.initialise();
+  cub_grid.initialise();
+
+  const vector<cepgen::GridHandler<3, 1>::point_t> points{
+      {0.13, 0.37, 1.01}, {-0.71, -0.35, 0.62}, {0.45, 1.5, 1.33}, {0., 0., 1.}};
+  for (const auto& [x, y, z] : points)
+    CG_TEST_EQUIV(lin_grid.eval({x, y, z}).at(0), linear(x, y, z), "multilinear interpolation");
+  // Catmull-Rom interpolation is exact for quadratic functions of regularly-spaced coordinates
+  for (const auto& [x, y, z] : points)
+    CG_TEST_EQUIV(cub_grid.eval({x, y, z}).at(0), quadratic(x, y, z), "cubic interpolation");
+  // ... including in the first and last cells of the grid
+  for (const auto& [x, y, z] : vector<cepgen::GridHandler<3, 1>::point_t>{{-0.93, 0.37, 0.1}, {0.91, -0.35, 1.9}})
+    CG_TEST_EQUIV(cub_grid.eval({x, y, z}).at(0), quadratic(x, y, z), "cubic interpolation in edge cells");
+  // out-of-range coordinates are clamped to the grid boundaries
+  CG_TEST_EQUIV(lin_grid.eval({-5., 3., 10.}).at(0), linear(-1., 2., 2.), "overflow/underflow coordinates");
+
+  vector<cepgen::GridHandler<3, 1>::values_t> batch;
+  lin_grid.eval(points, batch);
+  CG_TEST_EQUAL(batch.size(), points.size(), "batch evaluation size");
+  for (size_t i = 0; i < points.size(); ++i)
+    CG_TEST_EQUAL(batch.at(i).at(0), lin_grid.eval(points.at(i)).at(0), "batch evaluation");
+
+  // binary storage and memory-mapped readout
+  const string binary_file = "test_grid_handler.bin";
+  const string metadata = "grid provenance";  // not a multiple of 8 bytes, to probe the blocks alignment
+  lin_grid.save(binary_file, metadata);
+  cepgen::GridHandler<3, 1> loaded_grid(cepgen::GridType::linear);
+  CG_TEST(loaded_grid.isBinary(binary_file), "binary grid file identification");
+  CG_TEST_EQUAL(loaded_grid.load(binary_file), metadata, "binary grid metadata");
+  for (const auto& point : points)
+    CG_TEST_EQUAL(loaded_grid.eval(point).at(0), lin_grid.eval(point).at(0), "binary grid readout");
+  CG_TEST_EQUAL(loaded_grid.values().size(), lin_grid.values().size(), "binary grid nodes");
+  remove(binary_file.c_str());
+
+  CG_TEST_SUMMARY;
+}
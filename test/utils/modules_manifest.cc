@@ -0,0 +1,80 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <map>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/FunctionalFactory.h"
+#include "CepGen/Modules/ProcessFactory.h"
+#include "CepGen/Process/Process.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Functional.h"
+#include "CepGen/Utils/String.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  cepgen::ArgumentsParser(argc, argv).parse();
+  cepgen::initialise();
+
+  map<string, string> functionals;  // functional evaluators declared in the modules manifest, and their add-on
+  cepgen::callPath("CepGenModules.txt", [&functionals](const auto& path) {
+    for (const auto& line : cepgen::utils::split(cepgen::utils::readFile(path), '\n'))
+      if (const auto fields = cepgen::utils::split(line, ' ', true); fields.size() == 3 && fields.at(1) == "FUNCTIONAL")
+        functionals[fields.at(2)] = fields.at(0);
+    return true;
+  });
+  if (functionals.empty()) {
+    CG_LOG << "No functional evaluator add-on declared in the modules manifest. Skipping the test.";
+    return 0;
+  }
+
+  auto& factory = cepgen::FunctionalFactory::get();
+  CG_TEST_EQUAL(factory.size(), 0ul, "no add-on functional evaluator loaded at initialisation");
+  if (cepgen::ProcessFactory::get().has("pptoff")) {  // building a kt-factorised process only loads its providers
+    auto process = cepgen::ProcessFactory::get().build(
+        "pptoff",
+        cepgen::ParametersList().set(
+            "kinematics",
+            cepgen::ParametersList().set<double>("sqrtS", 13.e3).set<string>("partonFluxes", "BudnevElastic")));
+    process->initialise();
+    CG_TEST_EQUAL(factory.size(), 0ul, "no unrelated add-on loaded when building a kt-factorised process");
+  }
+  {  // building one module only loads the add-on providing it
+    const auto& [name, library] = *functionals.begin();
+    const auto num_library_modules = count_if(functionals.begin(), functionals.end(), [&library](const auto& mod) {
+      return mod.second == library;
+    });
+    auto functional = factory.build(name, cepgen::utils::Functional::fromExpression("2*x", {"x"}));
+    CG_TEST_EQUAL((*functional)(1.5), 3., "functional evaluator built from add-on '" + library + "'");
+    CG_TEST_EQUAL(factory.size(), static_cast<size_t>(num_library_modules), "add-on loaded on first build");
+  }
+  {  // an unknown module name loads all remaining add-ons to report the complete list of modules
+    CG_TEST(!factory.has("non-existing functional"), "unknown functional evaluator");
+    const auto modules = factory.modules();
+    const auto reported = [&modules](const auto& mod) {
+      return find(modules.begin(), modules.end(), mod.first) != modules.end();
+    };
+    CG_TEST(all_of(functionals.begin(), functionals.end(), reported), "all manifest functional evaluators reported");
+  }
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,74 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/TabulationCache.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+namespace {
+  /// Dummy tabulation, counting its number of builds
+  struct Table {
+    explicit Table(size_t& num_builds) { ++num_builds; }
+  };
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  string cache_directory;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("cache,c", "tabulations cache directory", &cache_directory, "cepgen_tabulation_cache_test")
+      .parse();
+
+  fs::remove_all(cache_directory);
+  {  // cache files are only retrieved for the configuration they were built with
+    cepgen::GridHandler<1, 1> grid(cepgen::GridType::linear);
+    for (int i = 0; i < 10; ++i)
+      grid.insert({0.1 * i}, {1. * i * i});
+    grid.initialise();
+    const cepgen::utils::TabulationCache cache(cache_directory, "test", "configuration");
+    CG_TEST(cache.enabled(), "tabulation caching enabled");
+    cepgen::GridHandler<1, 1> missing_grid(cepgen::GridType::linear);
+    CG_TEST(!cache.load(missing_grid), "no tabulation retrieved before storage");
+    cache.save(grid);
+    cepgen::GridHandler<1, 1> loaded_grid(cepgen::GridType::linear);
+    CG_TEST(cache.load(loaded_grid), "tabulation retrieved");
+    CG_TEST_EQUAL(loaded_grid.values().size(), grid.values().size(), "tabulation nodes");
+
+    // another configuration pointing to the same file (e.g. through a hash collision) must be rejected
+    fs::copy_file(cache.path(),
+                  cepgen::utils::TabulationCache(cache_directory, "test", "other configuration").path(),
+                  fs::copy_options::overwrite_existing);
+    cepgen::GridHandler<1, 1> other_grid(cepgen::GridType::linear);
+    CG_TEST(!cepgen::utils::TabulationCache(cache_directory, "test", "other configuration").load(other_grid),
+            "tabulation rejected on configuration mismatch");
+  }
+  fs::remove_all(cache_directory);
+
+  {  // tabulations are only built once per configuration
+    size_t num_builds = 0;
+    const auto table1 = cepgen::utils::SharedTabulations<const Table>::get("config1", num_builds),
+               table2 = cepgen::utils::SharedTabulations<const Table>::get("config1", num_builds),
+               table3 = cepgen::utils::SharedTabulations<const Table>::get("config2", num_builds);
+    CG_TEST_EQUAL(table1, table2, "tabulation shared among identical configurations");
+    CG_TEST(table1 != table3, "distinct tabulations for distinct configurations");
+    CG_TEST_EQUAL(num_builds, 2ul, "number of tabulations built");
+  }
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,56 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2025  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/Physics/GluonGrid.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Timer.h"
+
+using namespace std;
+
+/// Convert a text/MSTW interpolation grid into a memory-mappable binary grid file
+int main(int argc, char* argv[]) {
+  string type, input_file, output_file;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addArgument("type,t", "grid type (kmr, mstw, kb)", &type)
+      .addArgument("input,i", "input grid file", &input_file)
+      .addArgument("output,o", "output binary grid file", &output_file)
+      .parse();
+
+  cepgen::initialise();
+
+  cepgen::utils::Timer tmr;
+  if (type == "kmr")
+    kmr::GluonGrid::get(
+        kmr::GluonGrid::description().parameters().set("path", input_file).set("binaryOutput", output_file));
+  else if (type == "mstw")
+    (void)cepgen::StructureFunctionsFactory::get().build(
+        "MSTWGrid", cepgen::ParametersList().set("gridPath", input_file).set("binaryOutput", output_file));
+  else if (type == "kb")
+    (void)cepgen::StructureFunctionsFactory::get().build(
+        "KulaginBarinov", cepgen::ParametersList().set("gridFile", input_file).set("binaryOutput", output_file));
+  else
+    throw CG_FATAL("main") << "Unsupported grid type: '" << type << "'. Should be one of 'kmr', 'mstw', or 'kb'.";
+  CG_LOG << "Grid '" << input_file << "' converted into '" << output_file << "' in " << tmr.elapsed() << " s.";
+
+  return 0;
+}